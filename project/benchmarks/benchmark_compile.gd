@@ -0,0 +1,35 @@
+extends SceneTree
+## Measures building and compiling a large, deeply nested Schema.
+##
+## Run headless from the project directory:
+##     godot --headless -s res://benchmarks/benchmark_compile.gd
+
+const DEPTH := 7
+const WIDTH := 4
+const ITERATIONS := 5
+
+func _init() -> void:
+	print("Schema with %d levels of %d properties" % [DEPTH, WIDTH])
+
+	var total_usec = 0
+	for i in ITERATIONS:
+		# Every iteration differs in its leaves, so no compiled rules are reused
+		var definition = _make_level(DEPTH, i)
+		var start = Time.get_ticks_usec()
+		var schema = Schema.build_schema(definition)
+		schema.validate({})
+		total_usec += Time.get_ticks_usec() - start
+
+	print("  build + compile: %d usec per Schema" % (total_usec / ITERATIONS))
+	quit()
+
+func _make_level(depth: int, salt: int) -> Dictionary:
+	if depth == 0:
+		return {"type": "string", "minLength": salt}
+
+	var properties = {}
+	for i in WIDTH:
+		var child = _make_level(depth - 1, salt)
+		child["description"] = "level %d, property %d" % [depth, i]
+		properties["p%d" % i] = child
+	return {"type": "object", "properties": properties, "required": ["p0"]}
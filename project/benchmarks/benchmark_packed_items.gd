@@ -0,0 +1,37 @@
+extends SceneTree
+## Compares number-only "items" on a packed array with the same values in an Array.
+##
+## Run headless from the project directory:
+##     godot --headless -s res://benchmarks/benchmark_packed_items.gd
+
+const ITEM_COUNT := 1000000
+const ITERATIONS := 10
+
+func _init() -> void:
+	var schema = Schema.build_schema({
+		"type": "array",
+		"items": {"type": "number", "minimum": 0, "maximum": 1}
+	})
+
+	var heights = PackedFloat32Array()
+	heights.resize(ITEM_COUNT)
+	for i in ITEM_COUNT:
+		heights[i] = float(i % 1000) / 1000.0
+	var boxed = Array(heights)
+
+	# Warm up compilation
+	schema.validate(heights)
+
+	var packed_usec = _measure(schema, heights)
+	var boxed_usec = _measure(schema, boxed)
+
+	print("validate() x%d on %d floats" % [ITERATIONS, ITEM_COUNT])
+	print("  Array:              %d usec" % boxed_usec)
+	print("  PackedFloat32Array: %d usec (%.2fx)" % [packed_usec, float(boxed_usec) / max(packed_usec, 1)])
+	quit()
+
+func _measure(schema: Schema, data: Variant) -> int:
+	var start = Time.get_ticks_usec()
+	for i in ITERATIONS:
+		schema.validate(data)
+	return Time.get_ticks_usec() - start
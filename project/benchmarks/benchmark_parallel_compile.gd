@@ -0,0 +1,40 @@
+extends SceneTree
+## Compares compiling a Schema with many large definitions on one thread and
+## on the WorkerThreadPool.
+##
+## Run headless from the project directory:
+##     godot --headless -s res://benchmarks/benchmark_parallel_compile.gd
+
+const DEFINITIONS := 256
+const PROPERTIES := 24
+const ITERATIONS := 3
+
+func _init() -> void:
+	print("Schema with %d definitions of %d properties" % [DEFINITIONS, PROPERTIES])
+
+	var previous_threshold = Schema.get_parallel_compile_threshold()
+	for threshold in [0, 16]:
+		Schema.set_parallel_compile_threshold(threshold)
+		var total_usec = 0
+		for i in ITERATIONS:
+			# Every run differs in its constraints, so no compiled rules are reused
+			var definition = _make_schema(threshold * ITERATIONS + i)
+			var start = Time.get_ticks_usec()
+			Schema.build_schema(definition)
+			total_usec += Time.get_ticks_usec() - start
+		var label = "serial" if threshold == 0 else "parallel"
+		print("  %s: %d usec per Schema" % [label, total_usec / ITERATIONS])
+
+	Schema.set_parallel_compile_threshold(previous_threshold)
+	quit()
+
+func _make_schema(salt: int) -> Dictionary:
+	var definitions = {}
+	var properties = {}
+	for d in DEFINITIONS:
+		var fields = {}
+		for p in PROPERTIES:
+			fields["f%d" % p] = {"type": "string", "pattern": "^[a-z]{%d,}$" % (p + 1), "maxLength": salt + d + 64}
+		definitions["d%d" % d] = {"type": "object", "properties": fields, "required": ["f0"]}
+		properties["p%d" % d] = {"$ref": "#/definitions/d%d" % d}
+	return {"type": "object", "definitions": definitions, "properties": properties}
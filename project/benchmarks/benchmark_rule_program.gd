@@ -0,0 +1,71 @@
+extends SceneTree
+## Compares tree-walking validation with the linearized rule program.
+##
+## Run headless from the project directory:
+##     godot --headless -s res://benchmarks/benchmark_rule_program.gd
+
+const ITERATIONS := 2000
+
+func _init() -> void:
+	var schema_dict = {
+		"type": "object",
+		"properties": {
+			"name": {"type": "string", "minLength": 1, "maxLength": 64},
+			"version": {"type": "integer", "minimum": 1},
+			"players": {
+				"type": "array",
+				"maxItems": 64,
+				"items": {
+					"type": "object",
+					"properties": {
+						"id": {"type": "integer", "minimum": 0},
+						"nick": {"type": "string", "minLength": 3, "maxLength": 16},
+						"hp": {"type": "number", "minimum": 0, "maximum": 100},
+						"position": {"type": "array", "minItems": 2, "maxItems": 3, "items": {"type": "number"}}
+					},
+					"required": ["id", "nick"]
+				}
+			},
+			"settings": {
+				"type": "object",
+				"maxProperties": 16,
+				"properties": {
+					"volume": {"type": "number", "minimum": 0, "maximum": 1},
+					"difficulty": {"type": "string", "enum": ["easy", "normal", "hard"]}
+				}
+			}
+		},
+		"required": ["name", "version"]
+	}
+
+	var players = []
+	for i in 32:
+		players.append({"id": i, "nick": "player_%d" % i, "hp": 50.0 + i, "position": [i * 1.5, i * 2.0]})
+	var data = {
+		"name": "arena",
+		"version": 3,
+		"players": players,
+		"settings": {"volume": 0.8, "difficulty": "normal"}
+	}
+
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+
+	# Warm up compilation and lowering
+	tree_schema.validate(data)
+	program_schema.validate(data)
+
+	var tree_usec = _measure(tree_schema, data)
+	var program_usec = _measure(program_schema, data)
+
+	print("validate() x%d" % ITERATIONS)
+	print("  tree:    %d usec" % tree_usec)
+	print("  program: %d usec (%.2fx)" % [program_usec, float(tree_usec) / max(program_usec, 1)])
+	quit()
+
+func _measure(schema: Schema, data: Variant) -> int:
+	var start = Time.get_ticks_usec()
+	for i in ITERATIONS:
+		schema.validate(data)
+	return Time.get_ticks_usec() - start
@@ -0,0 +1,58 @@
+extends SceneTree
+## Measures validate() throughput of one shared Schema across threads.
+##
+## Run headless from the project directory:
+##     godot --headless -s res://benchmarks/benchmark_thread_scaling.gd
+
+const ITERATIONS := 20000
+const THREAD_COUNTS := [1, 2, 4, 8]
+
+var schema: Schema
+var data: Dictionary
+
+func _init() -> void:
+	schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"id": {"type": "integer", "minimum": 0},
+			"name": {"type": "string", "minLength": 1, "maxLength": 32},
+			"tags": {"type": "array", "maxItems": 8, "items": {"type": "string"}},
+			"stats": {
+				"type": "object",
+				"properties": {
+					"hp": {"type": "number", "minimum": 0, "maximum": 100},
+					"level": {"type": "integer", "minimum": 1}
+				},
+				"required": ["hp"]
+			}
+		},
+		"required": ["id", "name"]
+	})
+	data = {"id": 7, "name": "slime", "tags": ["enemy", "blue"], "stats": {"hp": 25.0, "level": 3}}
+
+	# Warm up compilation so only validation is measured
+	schema.validate(data)
+
+	print("validate() x%d on a shared Schema" % ITERATIONS)
+	var baseline_usec := 0
+	for thread_count in THREAD_COUNTS:
+		var usec = _measure(thread_count)
+		if thread_count == 1:
+			baseline_usec = usec
+		print("  %d thread(s): %d usec (%.2fx)" % [thread_count, usec, float(baseline_usec) / max(usec, 1)])
+	quit()
+
+func _measure(thread_count: int) -> int:
+	var threads = []
+	var start = Time.get_ticks_usec()
+	for i in thread_count:
+		var thread = Thread.new()
+		thread.start(_validate_many.bind(ITERATIONS / thread_count))
+		threads.append(thread)
+	for thread in threads:
+		thread.wait_to_finish()
+	return Time.get_ticks_usec() - start
+
+func _validate_many(count: int) -> void:
+	for i in count:
+		schema.validate(data)
@@ -542,3 +542,96 @@ func test_contains_with_nested_contains() -> void:
 	expect(schema.validate([["a", "b"], ["c", "target"], ["d"]]).is_valid(), "Nested array containing target string should validate")
 	expect(schema.validate([[["target"]], ["c", "target"]]).is_valid(), "Multiple nested arrays with target should validate")
 	expect(!schema.validate([["a", "b"], ["c", "d"], ["e"]]).is_valid(), "No nested arrays containing target should not validate")
+
+func test_parallel_items_match_sequential() -> void:
+	var definition = {
+		"type": "array",
+		"items": {
+			"type": "object",
+			"properties": {"id": {"type": "integer", "minimum": 0}},
+			"required": ["id"]
+		}
+	}
+	var sequential = Schema.build_schema(definition)
+	var parallel = Schema.build_schema(definition)
+	parallel.set_parallel_items_threshold(1000)
+	expect_equal(parallel.get_parallel_items_threshold(), 1000, "Threshold should be stored")
+
+	var items = []
+	for i in range(5000):
+		items.append({"id": i})
+	expect(parallel.validate(items).is_valid(), "Large valid array should validate in parallel")
+	expect(parallel.is_data_valid(items), "Large valid array should pass is_data_valid in parallel")
+
+	items[7] = {"id": -1}
+	items[2600] = {}
+	items[4999] = {"id": "x"}
+	var expected = sequential.validate(items)
+	var result = parallel.validate(items)
+	expect(!result.is_valid(), "Invalid items should fail in parallel")
+	expect(!parallel.is_data_valid(items), "Invalid items should fail is_data_valid in parallel")
+	expect_equal(result.error_count(), expected.error_count(), "Parallel error count should match sequential")
+	expect_equal(result.get_errors(), expected.get_errors(), "Parallel errors should be reported in index order")
+
+func test_packed_numeric_items() -> void:
+	var schema_dict = {"type": "array", "items": {"type": "number", "minimum": 0, "maximum": 1}}
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+
+	var floats = PackedFloat32Array()
+	floats.resize(1000)
+	floats.fill(0.5)
+	for schema in [tree_schema, program_schema]:
+		expect(schema.validate(floats).is_valid(), "Packed floats inside the range should pass")
+
+	floats[2] = -0.5
+	floats[700] = 1.5
+	for schema in [tree_schema, program_schema]:
+		var result = schema.validate(floats)
+		expect_equal(result.error_count(), 2, "Each value outside the range should be reported")
+		expect_equal(result.get_error_path(0), "/2", "First error should point at its index")
+		expect_equal(result.get_error_constraint(0), "minimum", "Low value should violate minimum")
+		expect_equal(result.get_error_path(1), "/700", "Second error should point at its index")
+		expect_equal(result.get_error_constraint(1), "maximum", "High value should violate maximum")
+		expect(!schema.is_data_valid(floats), "Packed floats outside the range should fail is_data_valid")
+
+	# Same errors as the boxed Array path
+	var boxed = tree_schema.validate(Array(floats))
+	expect_equal(boxed.get_all_error_paths(), tree_schema.validate(floats).get_all_error_paths(), "Packed and boxed items should report the same paths")
+
+	var integer_schema = Schema.build_schema({"items": {"type": "integer", "multipleOf": 3, "exclusiveMaximum": 100}})
+	expect(integer_schema.is_data_valid(PackedInt64Array([0, 3, 99, -6])), "Multiples of 3 below 100 should pass")
+	var integer_result = integer_schema.validate(PackedInt32Array([3, 4, 101]))
+	expect_equal(integer_result.error_count(), 3, "Non-multiple and out of range values should be reported")
+	expect_equal(integer_result.get_error_path(0), "/1", "Non-multiple should point at its index")
+	expect(!integer_schema.is_data_valid(PackedFloat64Array([3.0, 4.5])), "Fractional floats should not be integers")
+	expect(integer_schema.is_data_valid(PackedFloat64Array([3.0, 9.0])), "Integral floats should be integers")
+
+func test_packed_string_items() -> void:
+	var schema_dict = {
+		"type": "array",
+		"items": {"type": "string", "minLength": 2, "maxLength": 6, "enum": ["enemy", "ally", "boss", "ÿÿÿÿ"]}
+	}
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+
+	var tags = PackedStringArray(["enemy", "ally", "boss", "ally"])
+	for schema in [tree_schema, program_schema]:
+		expect(schema.validate(tags).is_valid(), "Allowed tags should pass")
+
+	# "ÿÿÿÿ" is 4 characters but 8 UTF-8 bytes
+	tags = PackedStringArray(["enemy", "npc", "ally", "ÿÿÿÿ"])
+	for schema in [tree_schema, program_schema]:
+		var result = schema.validate(tags)
+		expect_equal(result.get_all_error_paths(), tree_schema.validate(Array(tags)).get_all_error_paths(), "Packed and boxed items should report the same paths")
+		expect(result.get_violated_constraints().has("enum"), "Unknown tag should violate enum")
+		expect(result.get_violated_constraints().has("maxLength"), "Length should be counted in UTF-8 bytes")
+		expect(!schema.is_data_valid(tags), "Invalid tags should fail is_data_valid")
+
+	var pattern_schema = Schema.build_schema({"items": {"pattern": "^[a-z_]+$", "format": "hostname"}})
+	expect(pattern_schema.is_data_valid(PackedStringArray(["menu", "title"])), "Matching strings should pass")
+	var pattern_result = pattern_schema.validate(PackedStringArray(["menu", "Title"]))
+	expect_equal(pattern_result.error_count(), 1, "Non-matching string should be reported")
+	expect_equal(pattern_result.get_error_path(0), "/1", "Error should point at the non-matching index")
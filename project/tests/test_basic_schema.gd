@@ -102,3 +102,155 @@ func test_load_from_json_with_meta_validation() -> void:
 	expect(schema != null, "Invalid Schema should still return Schema object")
 	expect(!schema.is_valid(), "Schema with meta-validation errors should be invalid")
 	expect(schema.get_compile_errors().size() > 0, "Should have compilation errors from meta-validation")
+
+func test_is_data_valid() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"name": {"type": "string", "minLength": 2},
+			"tags": {"type": "array", "items": {"type": "string"}},
+			"kind": {"anyOf": [{"const": "a"}, {"const": "b"}]}
+		},
+		"required": ["name"]
+	})
+
+	var valid_data = {"name": "alice", "tags": ["x", "y"], "kind": "b"}
+	var invalid_data = {"name": "a", "tags": ["x", 1], "kind": "c"}
+
+	expect(schema.is_data_valid(valid_data), "Valid data should pass the boolean check")
+	expect(!schema.is_data_valid(invalid_data), "Invalid data should fail the boolean check")
+	expect(!schema.is_data_valid({}), "Missing required property should fail the boolean check")
+	expect_equal(schema.is_data_valid(valid_data), schema.validate(valid_data).is_valid(), "Boolean check should agree with validate() for valid data")
+	expect_equal(schema.is_data_valid(invalid_data), schema.validate(invalid_data).is_valid(), "Boolean check should agree with validate() for invalid data")
+	expect(schema.validate(invalid_data).error_count() > 2, "validate() should still collect every error")
+
+func test_validate_batch() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {"id": {"type": "integer", "minimum": 1}},
+		"required": ["id"]
+	})
+	var documents = [{"id": 1}, {"id": 0}, {}, {"id": 7}]
+
+	var batch = schema.validate_batch(documents)
+	var valid: PackedByteArray = batch["valid"]
+	var errors: Dictionary = batch["errors"]
+
+	expect_equal(valid.size(), documents.size(), "Every document should have a validity flag")
+	expect_equal(Array(valid), [1, 0, 0, 1], "Validity flags should match each document")
+	expect_equal(errors.keys(), [1, 2], "Errors should only be reported for failing documents")
+
+	for index in errors:
+		var expected = schema.validate(documents[index])
+		expect_equal(errors[index].get_errors(), expected.get_errors(), "Batch errors should match validate()")
+
+	expect_equal(schema.validate_batch([])["valid"].size(), 0, "Empty batch should produce no flags")
+
+func test_validate_batch_parallel() -> void:
+	var schema = Schema.build_schema({
+		"definitions": {"positive": {"type": "integer", "minimum": 1}},
+		"type": "object",
+		"properties": {"id": {"$ref": "#/definitions/positive"}},
+		"required": ["id"]
+	})
+	var documents = []
+	for i in range(1000):
+		documents.append({"id": i % 7})
+
+	var serial = schema.validate_batch(documents)
+	var parallel = schema.validate_batch_parallel(documents)
+
+	expect_equal(parallel["valid"], serial["valid"], "Parallel validity flags should match serial batch validation")
+	expect_equal(parallel["errors"].keys(), serial["errors"].keys(), "Parallel failing indices should match in document order")
+	for index in parallel["errors"]:
+		expect_equal(parallel["errors"][index].get_errors(), serial["errors"][index].get_errors(), "Parallel errors should match serial errors")
+
+func test_subschemas_differing_deep_down_compile_separately() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"a": {"type": "object", "properties": {"x": {"type": "object", "properties": {"y": {"maximum": 1}}}}},
+			"b": {"type": "object", "properties": {"x": {"type": "object", "properties": {"y": {"maximum": 2}}}}},
+			"c": {"type": "object", "properties": {"x": {"type": "object", "properties": {"y": {"maximum": 1}}}}}
+		}
+	})
+
+	expect(not schema.validate({"a": {"x": {"y": 2}}}).is_valid(), "a.x.y should use maximum 1")
+	expect(schema.validate({"b": {"x": {"y": 2}}}).is_valid(), "b.x.y should use maximum 2")
+	expect(not schema.validate({"c": {"x": {"y": 2}}}).is_valid(), "c.x.y should share the rules of a.x.y")
+
+func test_rule_cache_eviction() -> void:
+	var previous_capacity = Schema.get_rule_cache_capacity()
+	Schema.clear_rule_cache()
+	Schema.set_rule_cache_capacity(4)
+
+	var schemas = []
+	for i in 10:
+		schemas.append(Schema.build_schema({"type": "object", "properties": {"n": {"type": "integer", "minimum": i}}}))
+
+	var stats = Schema.get_rule_cache_stats()
+	expect(stats.entries <= 4, "Rule cache should not grow past its capacity")
+	expect(stats.evictions > 0, "Rule cache should evict entries past its capacity")
+	expect(stats.bytes > 0, "Rule cache should estimate the memory of its entries")
+
+	# Evicted rules stay alive in the schemas compiled with them
+	expect(schemas[0].validate({"n": 0}).is_valid(), "Evicted schema should still accept valid data")
+	expect(not schemas[9].validate({"n": 8}).is_valid(), "Evicted schema should still reject invalid data")
+
+	var hits = stats.hits
+	Schema.build_schema({"type": "object", "properties": {"n": {"type": "integer", "minimum": 9}}})
+	expect(Schema.get_rule_cache_stats().hits > hits, "Recently compiled sub-schemas should be reused")
+
+	Schema.clear_rule_cache()
+	expect_equal(Schema.get_rule_cache_stats().entries, 0, "clear_rule_cache should remove every entry")
+	Schema.set_rule_cache_capacity(previous_capacity)
+
+func test_compiled_file_round_trip() -> void:
+	var definition = {
+		"type": "object",
+		"definitions": {"name": {"type": "string", "minLength": 2}},
+		"properties": {"name": {"$ref": "#/definitions/name"}, "tags": {"type": "array", "items": {"enum": ["a", "b"]}}},
+		"required": ["name"]
+	}
+	var schema = Schema.build_schema(definition)
+	var path = "user://test_compiled_file_round_trip.gdschemac"
+	expect_equal(schema.save_to_compiled_file(path), OK, "Root Schema should be saved")
+
+	var loaded = Schema.load_from_compiled_file(path, "", true)
+	expect(loaded != null, "Compiled file should load")
+	expect_equal(loaded.get_schema_definition(), definition, "Loaded definition should equal the saved one")
+	expect(loaded.validate({"name": "ok", "tags": ["a"]}).is_valid(), "Loaded Schema should accept valid data")
+	expect(not loaded.validate({"name": "x", "tags": ["c"]}).is_valid(), "Loaded Schema should reject invalid data")
+
+	# Containers shared between several places are not shared once decoded
+	var colors = ["red", "green"]
+	var shared = Schema.build_schema({"properties": {"fg": {"enum": colors}, "bg": {"enum": colors}}})
+	expect_equal(shared.save_to_compiled_file(path), OK, "Schema with shared containers should be saved")
+	var loaded_shared = Schema.load_from_compiled_file(path)
+	expect(loaded_shared != null, "Schema with shared containers should load from its compiled file")
+	expect(not loaded_shared.validate({"bg": "blue"}).is_valid(), "Loaded Schema should keep both enums")
+
+	# Damaged files fall back to the JSON Schema
+	var file = FileAccess.open(path, FileAccess.WRITE)
+	file.store_string("not a compiled schema")
+	file.close()
+	var json_path = "user://test_compiled_file_round_trip.json"
+	file = FileAccess.open(json_path, FileAccess.WRITE)
+	file.store_string(JSON.stringify(definition))
+	file.close()
+	var fallback = Schema.load_from_compiled_file(path, json_path)
+	expect(fallback != null, "Damaged compiled file should fall back to the JSON Schema")
+	expect(not fallback.validate({"name": "x"}).is_valid(), "Fallback Schema should validate like the original")
+
+	# Files saved with their source are outdated once the source is edited
+	expect_equal(Schema.load_from_json_file(json_path).save_to_compiled_file(path, json_path), OK, "Schema should be saved with its source")
+	expect(not Schema.load_from_compiled_file(path, json_path).validate({"name": "x"}).is_valid(), "Unchanged source should keep the compiled file")
+	definition["definitions"]["name"]["minLength"] = 1
+	file = FileAccess.open(json_path, FileAccess.WRITE)
+	file.store_string(JSON.stringify(definition))
+	file.close()
+	var edited = Schema.load_from_compiled_file(path, json_path)
+	expect(edited.validate({"name": "x"}).is_valid(), "Edited source should be loaded instead of the outdated compiled file")
+
+	DirAccess.remove_absolute(path)
+	DirAccess.remove_absolute(json_path)
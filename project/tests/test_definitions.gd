@@ -298,3 +298,29 @@ func test_mixed_defs_and_definitions() -> void:
 	expect(schema.validate({ "legacy": "text", "modern": 42 }).is_valid(), "Should handle mixed defs/definitions")
 	expect(!schema.validate({ "legacy": 123, "modern": 42 }).is_valid(), "Should fail with wrong legacy type")
 	expect(!schema.validate({ "legacy": "text", "modern": "text" }).is_valid(), "Should fail with wrong modern type")
+
+func test_parallel_compilation() -> void:
+	var previous_threshold = Schema.get_parallel_compile_threshold()
+	Schema.set_parallel_compile_threshold(2)
+
+	var definitions = {}
+	var properties = {}
+	for i in 16:
+		# Each definition refers to the next and to the root, linked after the workers finish
+		definitions["d%d" % i] = {
+			"type": "object",
+			"properties": {
+				"value": {"type": "integer", "minimum": i},
+				"next": {"$ref": "#/definitions/d%d" % ((i + 1) % 16)},
+				"root": {"$ref": "#"}
+			}
+		}
+		properties["p%d" % i] = {"$ref": "#/definitions/d%d" % i}
+	var schema = Schema.build_schema({"type": "object", "definitions": definitions, "properties": properties})
+
+	expect(schema.get_compile_errors().is_empty(), "Parallel compilation should not report errors")
+	expect(schema.validate({"p3": {"value": 3, "next": {"value": 4}, "root": {"p0": {"value": 0}}}}).is_valid(), "Parallel compiled Schema should accept valid data")
+	expect(not schema.validate({"p3": {"value": 3, "next": {"value": 3}}}).is_valid(), "Reference between definitions should be linked")
+	expect(not schema.validate({"p3": {"root": {"p0": {"value": -1}}}}).is_valid(), "Reference to the root should be linked")
+
+	Schema.set_parallel_compile_threshold(previous_threshold)
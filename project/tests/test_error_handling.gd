@@ -52,3 +52,92 @@ func test_validation_error_paths() -> void:
 	if result.error_count() > 0:
 		var error_path = result.get_error_path(0)
 		expect(error_path.contains("user"), "Error path should reference nested property")
+
+func test_error_budget() -> void:
+	var schema = Schema.build_schema({
+		"type": "array",
+		"items": {
+			"properties": {
+				"a": {"type": "integer"},
+				"b": {"type": "integer"},
+				"c": {"type": "integer"}
+			}
+		}
+	})
+	var bad_row = {"a": "x", "b": "y", "c": "z"}
+	var data = [bad_row, bad_row, bad_row]
+
+	expect_equal(schema.get_max_errors(), 0, "Error budget should be unlimited by default")
+	expect_equal(schema.validate(data).error_count(), 9, "Every error should be collected without a budget")
+
+	schema.set_max_errors(2)
+	var limited = schema.validate(data)
+	expect(!limited.is_valid(), "Limited validation should still fail")
+	expect_equal(limited.error_count(), 2, "Collected errors should stop at max_errors")
+	expect(schema.validate([{"a": 1}]).is_valid(), "Valid data should still validate with a budget")
+
+	schema.set_max_errors(0)
+	schema.set_max_errors_per_subtree(1)
+	var per_row = schema.validate(data)
+	expect_equal(per_row.error_count(), 3, "Each row should contribute one error")
+	expect_equal(per_row.get_error_path(2), "/2/a", "Traversal should continue with the next row")
+
+func test_error_budget_nested_subtrees() -> void:
+	var cell_schema = {
+		"properties": {
+			"a": {"type": "integer"},
+			"b": {"type": "integer"},
+			"c": {"type": "integer"}
+		}
+	}
+	var schema = Schema.build_schema({"type": "array", "items": {"type": "array", "items": cell_schema}})
+	var bad_cell = {"a": "x", "b": "y", "c": "z"}
+	var data = [[{"a": "x", "b": 1, "c": 1}, bad_cell], [bad_cell, bad_cell]]
+	schema.set_max_errors_per_subtree(2)
+
+	# Each cell has its own budget, the row stops once its cells used up its budget
+	var result = schema.validate(data)
+	var paths = []
+	for i in result.error_count():
+		paths.append(result.get_error_path(i))
+	expect_equal(paths, ["/0/0/a", "/0/1/a", "/0/1/b", "/1/0/a", "/1/0/b"], "Every nested subtree should be limited")
+
+	# A wrapping property is a subtree too
+	var wrapped = Schema.build_schema({"properties": {"rows": {"type": "array", "items": {"type": "array", "items": cell_schema}}}})
+	wrapped.set_max_errors_per_subtree(2)
+	expect_equal(wrapped.validate({"rows": data}).error_count(), 3, "The rows array should stop after its first row used up its budget")
+
+func test_error_message_formatting() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"mode": {"enum": ["easy", "hard", 3]},
+			"kind": {"type": ["string", "null"]},
+			"version": {"const": [1, 2]},
+			"pick": {"oneOf": [{"type": "integer"}, {"minimum": 0}]}
+		}
+	})
+
+	var result = schema.validate({"mode": "normal", "kind": 4, "version": [1], "pick": 5})
+	var messages = {}
+	for error in result.get_errors():
+		messages[error.instance_path] = error.message
+
+	expect_equal(messages.get("/mode"), "Value normal is not one of the allowed values: easy, hard, 3", "enum message should list the allowed values")
+	expect_equal(messages.get("/kind"), "Value has type integer but expected one of: string, null", "type message should list the allowed types")
+	expect_equal(messages.get("/version"), "Value [1] does not equal required constant [1, 2]", "const message should show both values")
+	expect_equal(messages.get("/pick"), "Value matched 2 oneOf schemas (indices: 0, 1) but exactly 1 is required", "oneOf message should list the matching indices")
+	expect(result.get_summary().contains("Value normal is not one of the allowed values"), "Summary should format deferred messages")
+
+	# Messages describe the data as it was validated
+	var data = {"version": [1]}
+	var mutated = schema.validate(data)
+	data["version"].append(3)
+	expect_equal(mutated.get_error(0).message, "Value [1] does not equal required constant [1, 2]", "Changing the data should not change reported messages")
+
+	# Also for errors kept from a speculative branch
+	var branch_schema = Schema.build_schema({"anyOf": [{"enum": [[0]]}, {"type": "string"}]})
+	var branch_data = [1]
+	var branch_result = branch_schema.validate(branch_data)
+	branch_data.append(2)
+	expect(branch_result.get_summary().contains("Value [1] is not one of the allowed values"), "Kept branch errors should describe the validated data")
@@ -118,3 +118,196 @@ func test_meta_schema_validation() -> void:
 	expect_equal(meta_schema.get_id(), schema_url, "Meta-schema ID should match")
 	expect_equal(meta_schema.get_schema_url(), schema_url, "Meta-schema ID should match")
 	expect_equal(meta_schema.get_title(), "Core schema meta-schema", "Meta-Schama title should match")
+
+func test_rule_program_matches_tree_validation() -> void:
+	var schema_dict = {
+		"type": "object",
+		"properties": {
+			"name": {"type": "string", "minLength": 2, "maxLength": 8},
+			"score": {"type": "number", "minimum": 0, "exclusiveMaximum": 100},
+			"tags": {
+				"type": "array",
+				"minItems": 1,
+				"items": {"type": "string", "pattern": "^[a-z]+$"}
+			},
+			"meta": {"type": "object", "maxProperties": 1}
+		},
+		"required": ["name"]
+	}
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+
+	expect(program_schema.is_using_rule_program(), "Rule program should be enabled")
+	expect(!tree_schema.is_using_rule_program(), "Rule program should be disabled by default")
+
+	var samples = [
+		{"name": "alice", "score": 50, "tags": ["a", "b"], "meta": {}},
+		{"name": "a", "score": 100, "tags": ["ok", "Bad", 3], "meta": {"x": 1, "y": 2}},
+		{"score": -1, "tags": []},
+		"not an object",
+	]
+
+	for data in samples:
+		var expected = tree_schema.validate(data)
+		var actual = program_schema.validate(data)
+		expect_equal(actual.is_valid(), expected.is_valid(), "Rule program validity should match tree validation")
+		expect_equal(actual.get_errors(), expected.get_errors(), "Rule program errors should match tree validation")
+		expect_equal(program_schema.is_data_valid(data), expected.is_valid(), "Rule program boolean check should match tree validation")
+
+func test_rule_program_matches_tree_for_combinators() -> void:
+	var schema_dict = {
+		"type": "object",
+		"properties": {
+			"kind": {"enum": ["leaf", "branch"]},
+			"value": {"anyOf": [{"type": "integer"}, {"type": "string", "minLength": 2}]},
+			"shape": {"oneOf": [{"type": "number", "minimum": 0}, {"type": "number", "maximum": 10}]},
+			"flags": {"allOf": [{"type": "array"}, {"maxItems": 2}]},
+			"name": {"not": {"const": "root"}},
+			"children": {"type": "array", "items": {"$ref": "#"}}
+		},
+		"patternProperties": {"^x-": {"type": "string"}},
+		"additionalProperties": false,
+		"if": {"properties": {"kind": {"const": "leaf"}}},
+		"then": {"not": {"required": ["children"]}},
+		"else": {"required": ["children"]}
+	}
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+
+	var samples = [
+		{"kind": "leaf", "value": 3, "shape": 20, "x-note": "ok"},
+		{"kind": "branch", "children": [{"kind": "leaf", "value": "ab"}, {"kind": "leaf", "children": []}]},
+		{"kind": "leaf", "value": "a", "shape": 5, "flags": [1, 2, 3], "name": "root", "x-note": 1, "extra": true},
+		{"kind": "branch", "children": [{"kind": "branch", "children": [{"kind": "leaf", "value": []}]}]},
+	]
+
+	for data in samples:
+		var expected = tree_schema.validate(data)
+		var actual = program_schema.validate(data)
+		expect_equal(actual.is_valid(), expected.is_valid(), "Rule program validity should match tree validation")
+		expect_equal(actual.get_errors(), expected.get_errors(), "Rule program errors should match tree validation")
+		expect_equal(program_schema.is_data_valid(data), expected.is_valid(), "Rule program boolean check should match tree validation")
+
+func test_validate_patch_matches_full_validation() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"required": ["rooms"],
+		"properties": {
+			"rooms": {"type": "array", "items": {"$ref": "#/definitions/room"}},
+			"tags": {"type": "array", "uniqueItems": true}
+		},
+		"definitions": {
+			"room": {
+				"type": "object",
+				"required": ["name"],
+				"properties": {
+					"name": {"type": "string", "minLength": 1},
+					"size": {"anyOf": [{"type": "integer", "minimum": 1}, {"enum": ["small", "large"]}]}
+				}
+			}
+		}
+	})
+
+	var level = {"rooms": [], "tags": ["cave"]}
+	for i in 50:
+		level["rooms"].append({"name": "room_%d" % i, "size": i + 1})
+
+	var result = schema.validate_patch(level, null, PackedStringArray())
+	expect(result.is_valid(), "Initial document should be valid")
+
+	var edits = [
+		["/rooms/3/name", func(): level["rooms"][3]["name"] = ""],
+		["/rooms/7/size", func(): level["rooms"][7]["size"] = "huge"],
+		["/rooms/3/name", func(): level["rooms"][3]["name"] = "armory"],
+		["/tags/1", func(): level["tags"].append("cave")],
+		["/rooms/9/name", func(): level["rooms"][9].erase("name")],
+		["/rooms/7", func(): level["rooms"][7] = {"name": "hall", "size": "large"}],
+	]
+	for edit in edits:
+		edit[1].call()
+		result = schema.validate_patch(level, result, PackedStringArray([edit[0]]))
+		var full = schema.validate(level)
+		expect_equal(result.get_all_error_paths(), full.get_all_error_paths(), "Patched errors should match full validation after editing %s" % edit[0])
+		expect_equal(result.get_violated_constraints(), full.get_violated_constraints(), "Patched constraints should match full validation after editing %s" % edit[0])
+
+	# Removing the edited keys again restores a valid document
+	level["tags"].pop_back()
+	level["rooms"][9]["name"] = "vault"
+	result = schema.validate_patch(level, result, PackedStringArray(["/tags", "/rooms/9/name"]))
+	expect(result.is_valid(), "Document should be valid after undoing the edits")
+
+func test_validate_patch_with_shared_containers() -> void:
+	var room = {"type": "object", "properties": {"name": {"type": "string", "minLength": 1}}}
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {"rooms": {"type": "array", "items": room}, "spawn": room}
+	})
+
+	# The spawn room is also listed in rooms
+	var level = {"rooms": [{"name": "hall"}, {"name": "gate"}]}
+	level["spawn"] = level["rooms"][1]
+	var result = schema.validate_patch(level, null, PackedStringArray())
+	expect(result.is_valid(), "Initial document should be valid")
+
+	level["rooms"][1]["name"] = ""
+	result = schema.validate_patch(level, result, PackedStringArray(["/rooms/1/name"]))
+	expect_equal(result.get_all_error_paths(), schema.validate(level).get_all_error_paths(), "Edit through one path should be reported at every path to the shared room")
+
+	# Replaced rooms are no longer kept by the patch state
+	level["rooms"][0] = {"name": ""}
+	result = schema.validate_patch(level, result, PackedStringArray(["/rooms/0"]))
+	expect_equal(result.get_all_error_paths(), schema.validate(level).get_all_error_paths(), "Patched errors should match full validation after replacing a room")
+
+func test_result_cache() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"required": ["seq"],
+		"properties": {"seq": {"type": "integer", "minimum": 0}}
+	})
+	schema.set_result_cache_capacity(2)
+
+	expect(schema.validate({"seq": 1}).is_valid(), "First validation should be valid")
+	expect(schema.validate({"seq": 1}).is_valid(), "Equal data should hit the cache")
+	expect(schema.is_data_valid({"seq": 1}), "is_data_valid should use the cache")
+	var stats = schema.get_result_cache_stats()
+	expect_equal(stats.hits, 2, "Equal data should be served from the cache")
+	expect_equal(stats.misses, 1, "Only the first validation should miss")
+
+	# Values validating differently must not share an entry
+	var invalid = schema.validate({"seq": 1.5})
+	expect(not invalid.is_valid(), "Fractional seq should fail")
+	expect_equal(schema.validate({"seq": 1.5}).get_all_error_paths(), invalid.get_all_error_paths(), "Cached errors should be returned for equal data")
+	expect(not schema.validate({"seq": -1}).is_valid(), "Negative seq should fail")
+
+	stats = schema.get_result_cache_stats()
+	expect_equal(stats.entries, 2, "Cache should not grow past its capacity")
+
+	schema.clear_result_cache()
+	expect_equal(schema.get_result_cache_stats().entries, 0, "clear_result_cache should remove every entry")
+
+	schema.set_result_cache_max_bytes(1)
+	expect(schema.validate({"seq": 2}).is_valid(), "Validation should work when results do not fit")
+	expect_equal(schema.get_result_cache_stats().entries, 0, "Results larger than max_bytes should not be cached")
+
+func test_validate_into_reuses_result() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"required": ["id"],
+		"properties": {"id": {"type": "integer"}}
+	})
+
+	expect(schema.validate({"id": 1}) == schema.validate({"id": 2}), "Valid data should return the shared success result")
+	expect(schema.validate({"id": 1}) == SchemaValidationResult.success(), "success() should be the shared result")
+
+	var result = SchemaValidationResult.new()
+	expect(not schema.validate_into({"id": "x"}, result), "Invalid data should fail")
+	expect_equal(result.get_all_error_paths(), schema.validate({"id": "x"}).get_all_error_paths(), "validate_into should report the same errors as validate")
+
+	expect(schema.validate_into({"id": 3}, result), "Valid data should pass")
+	expect(result.is_valid(), "Reused result should be cleared")
+	expect_equal(result.error_count(), 0, "Reused result should hold no errors")
+
+	expect(not schema.validate_into({}, result), "Missing id should fail")
+	expect_equal(result.get_violated_constraints(), PackedStringArray(["required"]), "Reused result should only hold the last errors")
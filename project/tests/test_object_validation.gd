@@ -73,6 +73,34 @@ func test_object_additional_properties_false() -> void:
 	expect(schema.validate({"name": "John"}).is_valid(), "Object with only defined properties should validate")
 	expect(schema.validate({}).is_valid(), "Empty object should validate")
 	expect(!schema.validate({"name": "John", "extra": "value"}).is_valid(), "Object with additional properties should not validate")
+	expect(!schema.validate({"name": "John", "extra": null}).is_valid(), "Additional property with a null value should not validate")
+
+	var result = schema.validate({"name": "John", "extra": 1})
+	expect_equal(result.error_count(), 1, "Each additional property should report one error")
+	expect_equal(result.get_errors()[0]["instance_path"], "/extra", "Error should point at the additional property")
+
+func test_object_keywords_single_pass() -> void:
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"id": {"type": "integer"},
+			"s_label": {"maxLength": 3}
+		},
+		"patternProperties": {
+			"^s_": {"type": "string"}
+		},
+		"propertyNames": {"maxLength": 8},
+		"additionalProperties": {"type": "boolean"}
+	})
+
+	expect(schema.validate({"id": 1, "s_label": "abc", "s_other": "x", "flag": true}).is_valid(), "Every key category should validate")
+	expect(!schema.validate({"s_label": "abcd"}).is_valid(), "Declared property and pattern should both apply")
+	expect(!schema.validate({"s_label": 5}).is_valid(), "Pattern should apply to declared properties")
+	expect(!schema.validate({"flag": "yes"}).is_valid(), "Additional property should match additionalProperties")
+	expect(!schema.validate({"very_long_name": true}).is_valid(), "propertyNames should apply to every key")
+
+	var result = schema.validate({"id": "x", "s_a": 1, "extra": 0})
+	expect_equal(result.error_count(), 3, "Each invalid property should report its own error")
 
 func test_object_pattern_properties() -> void:
 	var schema = Schema.build_schema({
@@ -871,3 +871,163 @@ func test_reference_with_additional_properties() -> void:
 
 	expect(schema.validate(valid_data).is_valid(), "References in additionalProperties should work")
 	expect(!schema.validate(invalid_data).is_valid(), "References in additionalProperties should validate")
+
+func test_reference_registered_after_compilation() -> void:
+	# The reference cannot be linked while compiling, it links on first validation
+	var using_schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"item": {"$ref": "late-registered-id"}
+		}
+	})
+	expect(!using_schema.validate({"item": {"code": "ABC"}}).is_valid(), "Unregistered reference should fail validation")
+
+	var schema = Schema.build_schema({
+		"type": "object",
+		"properties": {
+			"code": {"type": "string"}
+		}
+	})
+	expect(Schema.register_schema(schema, "late-registered-id"), "Should register with custom ID")
+
+	expect(using_schema.validate({"item": {"code": "ABC"}}).is_valid(), "Reference should link once the schema is registered")
+	expect(!using_schema.validate({"item": {"code": 123}}).is_valid(), "Linked reference should validate against the registered schema")
+	Schema.unregister_schema("late-registered-id")
+
+func test_schema_with_references_is_freed() -> void:
+	var schema = Schema.build_schema({
+		"definitions": {"node": {"type": "object", "properties": {"next": {"$ref": "#/definitions/node"}}}},
+		"properties": {"head": {"$ref": "#/definitions/node"}, "self": {"$ref": "#"}}
+	})
+	expect(schema.validate({"head": {"next": {}}, "self": {}}).is_valid(), "Linked references should validate")
+
+	# Linked references within the document must not keep it alive
+	var watcher = weakref(schema)
+	schema = null
+	expect(watcher.get_ref() == null, "Schema should be freed once released")
+
+func test_reference_depth_limit() -> void:
+	var schema_dict = {
+		"type": "object",
+		"properties": {
+			"value": {"type": "integer"},
+			"next": {"$ref": "#"}
+		}
+	}
+	var tree_schema = Schema.build_schema(schema_dict)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_rule_program(true)
+	program_schema.set_max_depth(5000)
+	expect_equal(tree_schema.get_max_depth(), 50, "Default max depth should be 50")
+	expect_equal(program_schema.get_max_depth(), 5000, "Max depth should be stored")
+
+	var deep = {"value": 0}
+	for i in range(1, 2000):
+		deep = {"value": i, "next": deep}
+
+	# Past the limit validation fails instead of silently passing
+	var result = tree_schema.validate(deep)
+	expect(!result.is_valid(), "Data nested past max depth should fail")
+	expect(result.get_violated_constraints().has("maxDepth"), "Depth limit should be reported as maxDepth")
+	expect(!tree_schema.is_data_valid(deep), "Data nested past max depth should fail is_data_valid")
+
+	# The rule program keeps recursion on an explicit stack
+	expect(program_schema.validate(deep).is_valid(), "Rule program should validate deeply nested data")
+	var innermost = deep
+	while innermost.has("next"):
+		innermost = innermost["next"]
+	innermost["value"] = "wrong"
+	var deep_result = program_schema.validate(deep)
+	expect(!deep_result.is_valid(), "Rule program should find errors deep in the data")
+	expect_equal(deep_result.error_count(), 1, "Deep error should be reported once")
+
+func test_validation_memo_shared_and_cyclic_data() -> void:
+	var schema_dict = {
+		"type": "object",
+		"properties": {
+			"value": {"type": "integer"},
+			"left": {"$ref": "#"},
+			"right": {"$ref": "#"}
+		}
+	}
+	var plain_schema = Schema.build_schema(schema_dict)
+	var tree_schema = Schema.build_schema(schema_dict)
+	tree_schema.set_use_validation_memo(true)
+	var program_schema = Schema.build_schema(schema_dict)
+	program_schema.set_use_validation_memo(true)
+	program_schema.set_use_rule_program(true)
+	expect(!plain_schema.is_using_validation_memo(), "Validation memo should be disabled by default")
+	expect(tree_schema.is_using_validation_memo(), "Validation memo should be enabled")
+
+	# A shared invalid node is still reported at every path it is reached from
+	var shared = {"value": "wrong"}
+	var data = {"value": 1, "left": shared, "right": shared}
+	for schema in [plain_schema, tree_schema, program_schema]:
+		var result = schema.validate(data)
+		expect_equal(result.error_count(), 2, "Shared invalid node should be reported at both paths")
+		expect(!schema.is_data_valid(data), "Shared invalid node should fail is_data_valid")
+
+	# Cyclic data validates with the memo instead of failing on the depth limit
+	var node = {"value": 1}
+	node["left"] = node
+	node["right"] = {"value": 2, "left": node}
+	expect(!plain_schema.is_data_valid(node), "Cyclic data should reach the depth limit without the memo")
+	for schema in [tree_schema, program_schema]:
+		expect(schema.validate(node).is_valid(), "Cyclic data should validate with the memo")
+		expect(schema.is_data_valid(node), "Cyclic data should pass is_data_valid with the memo")
+
+	node["right"]["value"] = "wrong"
+	for schema in [tree_schema, program_schema]:
+		var result = schema.validate(node)
+		# Reached once through /left and once directly through /right
+		expect_equal(result.error_count(), 2, "Invalid node in a cycle should be reported once per path into the cycle")
+		expect(!schema.is_data_valid(node), "Invalid node in a cycle should fail is_data_valid")
+
+	# Break the cycles so the dictionaries are freed
+	node["right"].erase("left")
+	node.erase("left")
+
+func test_validation_memo_with_parallel_items() -> void:
+	var schema = Schema.build_schema({
+		"$ref": "#/definitions/node",
+		"definitions": {
+			"node": {
+				"type": "object",
+				"properties": {
+					"value": {"type": "integer"},
+					"children": {"type": "array", "items": {"$ref": "#/definitions/node"}}
+				}
+			}
+		}
+	})
+	schema.set_use_validation_memo(true)
+	schema.set_parallel_items_threshold(64)
+
+	# Every item cycles back to the node whose items are being validated in parallel
+	var node = {"value": 1, "children": []}
+	for i in 600:
+		node["children"].append(node)
+	expect(schema.validate(node).is_valid(), "Cyclic items validated in parallel should hit the memo")
+
+	node["children"].append({"value": "wrong", "children": [node]})
+	var result = schema.validate(node)
+	expect_equal(result.error_count(), 1, "Invalid item should be reported once")
+	expect_equal(result.get_error_path(0), "/children/600/value", "Invalid item should be reported at its path")
+
+	# Break the cycles so the dictionaries are freed
+	node["children"].clear()
+
+func test_equal_subschemas_with_refs_in_different_documents() -> void:
+	var wrapper = {"type": "object", "properties": {"v": {"$ref": "#/definitions/x"}}}
+	var strings = Schema.build_schema({
+		"definitions": {"x": {"type": "string"}},
+		"properties": {"w": wrapper.duplicate(true)}
+	})
+	var integers = Schema.build_schema({
+		"definitions": {"x": {"type": "integer"}},
+		"properties": {"w": wrapper.duplicate(true)}
+	})
+
+	expect(not strings.validate({"w": {"v": 1}}).is_valid(), "First document should resolve #/definitions/x to a string")
+	expect(integers.validate({"w": {"v": 1}}).is_valid(), "Equal subschema in another document should resolve its own #/definitions/x")
+	expect(not integers.validate({"w": {"v": "a"}}).is_valid(), "Second document should reject strings")
@@ -65,3 +65,28 @@ func test_boolean_schema_false() -> void:
 
 	expect(!schema.validate("anything").is_valid(), "False Schema should not validate any value")
 	expect(!schema.validate(null).is_valid(), "False Schema should not validate null")
+
+func test_keywords_apply_only_to_their_type() -> void:
+	var schema = Schema.build_schema({
+		"minLength": 3,
+		"minimum": 10,
+		"minItems": 2,
+		"required": ["id"],
+		"enum": ["abc", 5, 20, [1], [1, 2], {"name": "x"}, true]
+	})
+
+	expect(schema.validate("abc").is_valid(), "String keywords should apply to strings")
+	expect(schema.validate(20).is_valid(), "Numeric keywords should apply to numbers")
+	expect(schema.validate([1, 2]).is_valid(), "Array keywords should apply to arrays")
+	expect(schema.validate(true).is_valid(), "No type-specific keyword should apply to booleans")
+
+	var string_result = schema.validate("ab")
+	expect(!string_result.is_valid(), "Short string should fail minLength and enum")
+	expect_equal(string_result.error_count(), 2, "Only minLength and enum should report errors for strings")
+
+	var number_result = schema.validate(5)
+	expect(!number_result.is_valid(), "Number below minimum should not validate")
+	expect_equal(number_result.error_count(), 1, "Only minimum should report an error for numbers")
+
+	expect(!schema.validate([1]).is_valid(), "Array below minItems should not validate")
+	expect(!schema.validate({"name": "x"}).is_valid(), "Object without required property should not validate")
@@ -0,0 +1,93 @@
+#include "compiled_schema_file.hpp"
+#include "content_hash.hpp"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+namespace {
+
+constexpr uint32_t MAGIC = 0x43534447; // "GDSC" in little-endian
+constexpr uint64_t HEADER_SIZE = 4 + 4 + 4 + 8 + 8 + 8;
+
+uint64_t hash_bytes(const PackedByteArray &bytes) {
+	uint64_t hash = 0;
+	ContentHash::hash64(bytes, hash); // Hashes the raw bytes
+	return hash;
+}
+
+} // namespace
+
+Error CompiledSchemaFile::write(const String &path, const Dictionary &definition, uint64_t source_hash, uint32_t flags) {
+	const PackedByteArray payload = UtilityFunctions::var_to_bytes(definition);
+
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+	if (file.is_null()) {
+		return FileAccess::get_open_error();
+	}
+
+	file->store_32(MAGIC);
+	file->store_32(FORMAT_VERSION);
+	file->store_32(flags);
+	file->store_64(source_hash);
+	file->store_64(hash_bytes(payload));
+	file->store_64(static_cast<uint64_t>(payload.size()));
+	file->store_buffer(payload);
+
+	const Error err = file->get_error();
+	file->close();
+	return err == OK ? OK : ERR_FILE_CANT_WRITE;
+}
+
+Error CompiledSchemaFile::read(const String &path, Dictionary &r_definition, uint64_t &r_source_hash, uint32_t &r_flags) {
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+	if (file.is_null()) {
+		return FileAccess::get_open_error();
+	}
+
+	const uint64_t length = file->get_length();
+	if (length < HEADER_SIZE) {
+		return ERR_FILE_CORRUPT;
+	}
+	if (file->get_32() != MAGIC || file->get_32() != FORMAT_VERSION) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	r_flags = file->get_32();
+	r_source_hash = file->get_64();
+	const uint64_t checksum = file->get_64();
+	const uint64_t payload_size = file->get_64();
+	if (payload_size != length - HEADER_SIZE) {
+		return ERR_FILE_CORRUPT; // Truncated or padded
+	}
+
+	const PackedByteArray payload = file->get_buffer(static_cast<int64_t>(payload_size));
+	file->close();
+	if (static_cast<uint64_t>(payload.size()) != payload_size || hash_bytes(payload) != checksum) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	const Variant decoded = UtilityFunctions::bytes_to_var(payload);
+	if (decoded.get_type() != Variant::DICTIONARY) {
+		return ERR_FILE_CORRUPT;
+	}
+
+	r_definition = decoded;
+	return OK;
+}
+
+Error CompiledSchemaFile::hash_source(const String &json_path, uint64_t &r_hash) {
+	Ref<FileAccess> file = FileAccess::open(json_path, FileAccess::READ);
+	if (file.is_null()) {
+		return FileAccess::get_open_error();
+	}
+
+	const PackedByteArray source = file->get_buffer(static_cast<int64_t>(file->get_length()));
+	file->close();
+	r_hash = hash_bytes(source);
+	if (r_hash == 0) {
+		r_hash = 1; // 0 records an unknown source
+	}
+	return OK;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+
+namespace godot {
+
+/**
+ * @class CompiledSchemaFile
+ * @brief Reads and writes precompiled Schema files (.gdschemac)
+ *
+ * The file stores the Schema definition in Godot's binary Variant encoding,
+ * which decodes without the JSON parser, together with what was checked when
+ * it was written:
+ *
+ * | Offset | Size | Field                                               |
+ * |--------|------|-----------------------------------------------------|
+ * | 0      | 4    | Magic "GDSC"                                        |
+ * | 4      | 4    | FORMAT_VERSION                                      |
+ * | 8      | 4    | Flags                                               |
+ * | 12     | 8    | Hash of the JSON source file, 0 if saved without it |
+ * | 20     | 8    | Checksum of the payload bytes, verified on loading  |
+ * | 28     | 8    | Payload size                                        |
+ * | 36     | n    | var_to_bytes() of the definition                    |
+ *
+ * The source hash lets loading detect a JSON file edited after the compiled
+ * file was written. The binary encoding does not preserve containers shared
+ * between several places of the definition, so integrity is checked on the
+ * payload bytes rather than on a hash of the decoded definition.
+ *
+ * Compiled rules hold regexes and pointers into the Schema tree, so they are
+ * rebuilt on loading rather than stored.
+ */
+class CompiledSchemaFile {
+public:
+	/**
+	 * @brief Flags recorded when the file was written
+	 */
+	enum Flags : uint32_t {
+		FLAG_META_VALID = 1 << 0, // The definition passed meta-schema validation
+	};
+
+	/**
+	 * @brief Bumped whenever the layout or the meaning of a field changes
+	 */
+	static constexpr uint32_t FORMAT_VERSION = 3;
+
+	/**
+	 * @brief Writes a Schema definition
+	 * @param path Destination file
+	 * @param definition The root Schema definition
+	 * @param source_hash hash_source() of the JSON file the definition was loaded from, 0 if unknown
+	 * @param flags Flags values
+	 * @return OK, or the error that prevented writing
+	 */
+	static Error write(const String &path, const Dictionary &definition, uint64_t source_hash, uint32_t flags);
+
+	/**
+	 * @brief Reads a Schema definition
+	 * @param path Source file
+	 * @param r_definition Receives the definition
+	 * @param r_source_hash Receives the recorded hash of the JSON source, 0 if unknown
+	 * @param r_flags Receives the recorded flags
+	 * @return OK, ERR_FILE_UNRECOGNIZED for another format or version, ERR_FILE_CORRUPT for damaged files
+	 */
+	static Error read(const String &path, Dictionary &r_definition, uint64_t &r_source_hash, uint32_t &r_flags);
+
+	/**
+	 * @brief Hashes the bytes of a JSON source file
+	 * @param json_path The JSON Schema file
+	 * @param r_hash Receives the hash, never 0
+	 * @return OK, or the error that prevented reading
+	 */
+	static Error hash_source(const String &json_path, uint64_t &r_hash);
+};
+
+} // namespace godot
@@ -0,0 +1,173 @@
+#include "content_hash.hpp"
+#include "util.hpp"
+
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using namespace godot;
+
+namespace {
+
+/**
+ * @brief Streaming 64-bit hash state
+ */
+struct HashState {
+	uint64_t value = 0x243F6A8885A308D3ULL;
+
+	static uint64_t mix(uint64_t x) {
+		// splitmix64 finalizer
+		x ^= x >> 30;
+		x *= 0xBF58476D1CE4E5B9ULL;
+		x ^= x >> 27;
+		x *= 0x94D049BB133111EBULL;
+		x ^= x >> 31;
+		return x;
+	}
+
+	void add(uint64_t x) {
+		value = mix(value ^ mix(x + 0x9E3779B97F4A7C15ULL));
+	}
+
+	void add_bytes(const void *data, size_t size) {
+		add(size);
+		const uint8_t *bytes = static_cast<const uint8_t *>(data);
+		size_t offset = 0;
+		for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+			uint64_t word;
+			memcpy(&word, bytes + offset, sizeof(uint64_t));
+			add(word);
+		}
+		if (offset < size) {
+			uint64_t word = 0;
+			memcpy(&word, bytes + offset, size - offset);
+			add(word);
+		}
+	}
+
+	template <typename T>
+	void add_packed(const Variant &value) {
+		const T array = value;
+		add_bytes(array.ptr(), static_cast<size_t>(array.size()) * sizeof(*array.ptr()));
+	}
+};
+
+} // namespace
+
+bool ContentHash::hash64(const Variant &value, uint64_t &r_hash) {
+	static const std::unordered_map<uintptr_t, uint64_t> no_known_hashes;
+	return hash64(value, no_known_hashes, r_hash);
+}
+
+bool ContentHash::hash64(const Variant &value, const std::unordered_map<uintptr_t, uint64_t> &known_hashes, uint64_t &r_hash) {
+	HashState state;
+
+	// Explicit stack, documents can be deep or cyclic
+	std::vector<Variant> pending;
+	std::unordered_map<uintptr_t, uint64_t> visited; // Container identity -> visit order
+	pending.push_back(value);
+
+	while (!pending.empty()) {
+		const Variant current = pending.back();
+		pending.pop_back();
+
+		const Variant::Type type = current.get_type();
+		state.add(static_cast<uint64_t>(type));
+
+		switch (type) {
+			case Variant::NIL:
+				break;
+			case Variant::BOOL:
+				state.add(current.operator bool() ? 1 : 0);
+				break;
+			case Variant::INT:
+				state.add(static_cast<uint64_t>(current.operator int64_t()));
+				break;
+			case Variant::FLOAT: {
+				const double number = current.operator double();
+				uint64_t bits;
+				memcpy(&bits, &number, sizeof(bits));
+				state.add(bits);
+			} break;
+			case Variant::STRING:
+			case Variant::STRING_NAME: {
+				const String str = current;
+				state.add_bytes(str.ptr(), static_cast<size_t>(str.length()) * sizeof(char32_t));
+			} break;
+			case Variant::DICTIONARY:
+			case Variant::ARRAY: {
+				const uintptr_t container_id = SchemaUtil::get_container_id(current);
+				const auto known = known_hashes.find(container_id);
+				if (known != known_hashes.end()) {
+					state.add(known->second);
+					break;
+				}
+
+				const auto found = visited.find(container_id);
+				if (found != visited.end()) {
+					// Reference to a container hashed before, or an ancestor
+					state.add(~found->second);
+					break;
+				}
+				visited.emplace(container_id, visited.size());
+
+				if (type == Variant::DICTIONARY) {
+					const Dictionary dict = current;
+					const Array keys = dict.keys();
+					const Array values = dict.values();
+					state.add(static_cast<uint64_t>(keys.size()));
+					for (int64_t i = keys.size() - 1; i >= 0; i--) {
+						pending.push_back(values[i]);
+						pending.push_back(keys[i]);
+					}
+				} else {
+					const Array array = current;
+					state.add(static_cast<uint64_t>(array.size()));
+					for (int64_t i = array.size() - 1; i >= 0; i--) {
+						pending.push_back(array[i]);
+					}
+				}
+			} break;
+			case Variant::PACKED_BYTE_ARRAY:
+				state.add_packed<PackedByteArray>(current);
+				break;
+			case Variant::PACKED_INT32_ARRAY:
+				state.add_packed<PackedInt32Array>(current);
+				break;
+			case Variant::PACKED_INT64_ARRAY:
+				state.add_packed<PackedInt64Array>(current);
+				break;
+			case Variant::PACKED_FLOAT32_ARRAY:
+				state.add_packed<PackedFloat32Array>(current);
+				break;
+			case Variant::PACKED_FLOAT64_ARRAY:
+				state.add_packed<PackedFloat64Array>(current);
+				break;
+			case Variant::PACKED_VECTOR2_ARRAY:
+				state.add_packed<PackedVector2Array>(current);
+				break;
+			case Variant::PACKED_VECTOR3_ARRAY:
+				state.add_packed<PackedVector3Array>(current);
+				break;
+			case Variant::PACKED_VECTOR4_ARRAY:
+				state.add_packed<PackedVector4Array>(current);
+				break;
+			case Variant::PACKED_COLOR_ARRAY:
+				state.add_packed<PackedColorArray>(current);
+				break;
+			case Variant::PACKED_STRING_ARRAY: {
+				const PackedStringArray strings = current;
+				state.add(static_cast<uint64_t>(strings.size()));
+				for (int64_t i = 0; i < strings.size(); i++) {
+					const String &str = strings[i];
+					state.add_bytes(str.ptr(), static_cast<size_t>(str.length()) * sizeof(char32_t));
+				}
+			} break;
+			default:
+				return false; // Objects and math types are not plain data
+		}
+	}
+
+	r_hash = state.value;
+	return true;
+}
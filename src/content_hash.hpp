@@ -0,0 +1,41 @@
+#pragma once
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace godot {
+
+/**
+ * @class ContentHash
+ * @brief 64-bit hash of the content of a JSON-like Variant
+ *
+ * Unlike Variant::hash(), the hash covers nested containers completely, is 64
+ * bits wide and distinguishes every value that can validate differently.
+ * Shared and cyclic containers are hashed once and referenced by visit order
+ * afterwards, so hashing always terminates.
+ */
+class ContentHash {
+public:
+	/**
+	 * @brief Hashes the content of a Variant
+	 * @param value The value to hash
+	 * @param r_hash Receives the hash
+	 * @return False if the value contains a type whose content cannot be hashed (e.g. an Object)
+	 */
+	static bool hash64(const Variant &value, uint64_t &r_hash);
+
+	/**
+	 * @brief Hashes the content of a Variant, reusing the hashes of known containers
+	 * @param value The value to hash
+	 * @param known_hashes Hashes of nested containers by SchemaUtil::get_container_id(), used instead of descending
+	 * @param r_hash Receives the hash
+	 * @return False if the value contains a type whose content cannot be hashed (e.g. an Object)
+	 *
+	 * Hashing a tree bottom-up this way visits every container once (a Merkle hash).
+	 */
+	static bool hash64(const Variant &value, const std::unordered_map<uintptr_t, uint64_t> &known_hashes, uint64_t &r_hash);
+};
+
+} // namespace godot
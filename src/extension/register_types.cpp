@@ -21,6 +21,7 @@ void initialize_schema_module(ModuleInitializationLevel p_level) {
 	if (!ClassDB::class_exists("SchemaValidationResult")) {
 		GDREGISTER_CLASS(SchemaValidationResult);
 	}
+	SchemaValidationResult::create_shared_results();
 
 	// Preload and register the JSON Schema Draft 7 meta-schema
 	Schema::load_from_json_file("res://addons/GDSchema/schema/json_schema_draft_07.json", false);
@@ -30,6 +31,8 @@ void uninitialize_schema_module(ModuleInitializationLevel p_level) {
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE) {
 		return;
 	}
+
+	SchemaValidationResult::free_shared_results();
 }
 
 } // namespace godot
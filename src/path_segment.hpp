@@ -0,0 +1,67 @@
+#pragma once
+
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+
+namespace godot {
+
+/**
+ * @struct PathSegment
+ * @brief A single instance path segment, formatted lazily
+ *
+ * Holds either an object key or an array index. Array indices are only
+ * turned into strings when a path is materialized for an error report,
+ * so walking large arrays does not allocate a String per item.
+ */
+struct PathSegment {
+	String key;
+	int64_t index = -1;
+	const char *prefix = nullptr; // Optional literal prepended to the key (e.g. "propertyName:")
+
+	PathSegment() = default;
+
+	/**
+	 * @brief Creates a segment for an object key
+	 * @param p_key The property key
+	 */
+	PathSegment(const String &p_key) :
+			key(p_key) {}
+
+	/**
+	 * @brief Creates a segment for an object key with a literal prefix
+	 * @param p_prefix Prefix literal, must outlive the segment
+	 * @param p_key The property key
+	 */
+	PathSegment(const char *p_prefix, const String &p_key) :
+			key(p_key), prefix(p_prefix) {}
+
+	/**
+	 * @brief Creates a segment for an array index
+	 * @param p_index The item index
+	 */
+	explicit PathSegment(int64_t p_index) :
+			index(p_index) {}
+
+	/**
+	 * @brief Checks if the segment is empty and should not be added to a path
+	 * @return True if the segment has neither a key, prefix nor index
+	 */
+	bool is_empty() const { return index < 0 && prefix == nullptr && key.is_empty(); }
+
+	/**
+	 * @brief Formats the segment as a path string
+	 * @return Segment string (e.g. "name", "3" or "propertyName:name")
+	 */
+	String to_string() const {
+		if (index >= 0) {
+			return String::num_int64(index);
+		}
+		if (prefix) {
+			return String(prefix) + key;
+		}
+		return key;
+	}
+};
+
+} // namespace godot
@@ -0,0 +1,681 @@
+#include "rule_program.hpp"
+#include "../rule/all_of_rule.hpp"
+#include "../rule/any_of_rule.hpp"
+#include "../rule/not_rule.hpp"
+#include "../rule/object_rule.hpp"
+#include "../rule/one_of_rule.hpp"
+#include "../rule/ref_rule.hpp"
+#include "../rule/rule_group.hpp"
+#include "../rule/selector_rule.hpp"
+#include "../util.hpp"
+#include "../validation_context.hpp"
+
+#include <godot_cpp/core/error_macros.hpp>
+
+using namespace godot;
+
+void ValidationRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_call(this);
+}
+
+// ========== RuleProgramBuilder ==========
+
+void RuleProgramBuilder::emit_call(const ValidationRule *rule) {
+	RuleInstruction instruction;
+	instruction.op = OP_CALL_RULE;
+	instruction.rule = rule;
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::emit_check(RuleOpCode op, const ValidationRule *rule, int64_t int_arg, double float_arg) {
+	RuleInstruction instruction;
+	instruction.op = op;
+	instruction.rule = rule;
+	instruction.int_arg = int_arg;
+	instruction.float_arg = float_arg;
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::begin_items() {
+	RuleInstruction instruction;
+	instruction.op = OP_LOOP_ITEMS;
+	open_blocks.push_back(static_cast<uint32_t>(instructions.size()));
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::end_items() {
+	ERR_FAIL_COND(open_blocks.empty());
+	const uint32_t begin = open_blocks.back();
+	open_blocks.pop_back();
+
+	// Loop back to the first instruction of the body
+	RuleInstruction instruction;
+	instruction.op = OP_NEXT_ITEM;
+	instruction.jump = begin + 1;
+	instructions.push_back(instruction);
+
+	// Empty arrays and non-arrays skip the loop
+	instructions[begin].jump = static_cast<uint32_t>(instructions.size());
+}
+
+void RuleProgramBuilder::begin_packed_check(const ValidationRule *rule) {
+	RuleInstruction instruction;
+	instruction.op = OP_CHECK_PACKED;
+	instruction.rule = rule;
+	open_blocks.push_back(static_cast<uint32_t>(instructions.size()));
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::end_packed_check() {
+	ERR_FAIL_COND(open_blocks.empty());
+	const uint32_t begin = open_blocks.back();
+	open_blocks.pop_back();
+
+	RuleInstruction instruction;
+	instruction.op = OP_END_CHECK_PACKED;
+	instructions[begin].jump = static_cast<uint32_t>(instructions.size()) + 1;
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::emit_properties(const ValidationRule *rule) {
+	RuleInstruction instruction;
+	instruction.op = OP_BEGIN_PROPERTIES;
+	instruction.rule = rule;
+	instruction.jump = static_cast<uint32_t>(instructions.size()) + 2;
+	instructions.push_back(instruction);
+
+	instruction.op = OP_PROPERTY_CHECK;
+	instruction.jump = 0;
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::emit_reference(const ValidationRule *rule, const ValidationRule *target, const String &schema_segment) {
+	RuleInstruction instruction;
+	instruction.op = OP_CALL_REFERENCE;
+	instruction.rule = rule;
+	instruction.int_arg = add_subroutine(target); // Resolved to the entry point by finish()
+	instruction.schema_segment = schema_segment;
+	instructions.push_back(instruction);
+}
+
+uint32_t RuleProgramBuilder::add_subroutine(const ValidationRule *rule) {
+	const auto existing = subroutine_indices.find(rule);
+	if (existing != subroutine_indices.end()) {
+		return existing->second;
+	}
+
+	const uint32_t index = static_cast<uint32_t>(subroutines.size());
+	subroutines.push_back(rule);
+	subroutine_indices[rule] = index;
+	return index;
+}
+
+void RuleProgramBuilder::begin_combinator(CombinatorKind kind, const ValidationRule *rule) {
+	RuleInstruction instruction;
+	instruction.op = OP_BEGIN_COMBINATOR;
+	instruction.rule = rule;
+	instruction.int_arg = kind;
+	open_blocks.push_back(static_cast<uint32_t>(instructions.size()));
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::end_combinator() {
+	ERR_FAIL_COND(open_blocks.empty());
+	const uint32_t begin = open_blocks.back();
+	open_blocks.pop_back();
+
+	RuleInstruction instruction;
+	instruction.op = OP_END_COMBINATOR;
+	instruction.rule = instructions[begin].rule;
+	instructions[begin].jump = static_cast<uint32_t>(instructions.size());
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::begin_branch(const String &schema_segment, BranchCondition condition) {
+	RuleInstruction instruction;
+	instruction.op = OP_BEGIN_BRANCH;
+	instruction.int_arg = condition;
+	instruction.schema_segment = schema_segment;
+	open_blocks.push_back(static_cast<uint32_t>(instructions.size()));
+	instructions.push_back(instruction);
+}
+
+void RuleProgramBuilder::end_branch() {
+	ERR_FAIL_COND(open_blocks.empty());
+	const uint32_t begin = open_blocks.back();
+	open_blocks.pop_back();
+
+	// Skipped branches jump past OP_END_BRANCH, failing ones unwind to it
+	RuleInstruction instruction;
+	instruction.op = OP_END_BRANCH;
+	instructions[begin].jump = static_cast<uint32_t>(instructions.size());
+	instructions.push_back(instruction);
+}
+
+std::vector<RuleInstruction> RuleProgramBuilder::finish() {
+	RuleInstruction instruction;
+	instruction.op = OP_END;
+	instructions.push_back(instruction);
+
+	// Lowering a subroutine can queue more of them
+	std::vector<uint32_t> entries;
+	for (size_t i = 0; i < subroutines.size(); i++) {
+		entries.push_back(static_cast<uint32_t>(instructions.size()));
+		subroutine_entries[subroutines[i]] = entries.back();
+		subroutines[i]->lower(*this);
+
+		RuleInstruction return_instruction;
+		return_instruction.op = OP_RETURN;
+		instructions.push_back(return_instruction);
+	}
+
+	for (RuleInstruction &call : instructions) {
+		if (call.op == OP_CALL_REFERENCE) {
+			call.jump = entries[call.int_arg];
+		}
+	}
+
+	return std::move(instructions);
+}
+
+// ========== RuleProgram ==========
+
+std::shared_ptr<RuleProgram> RuleProgram::lower(const std::shared_ptr<const RuleGroup> &rules) {
+	auto program = std::make_shared<RuleProgram>();
+	program->root = rules;
+
+	RuleProgramBuilder builder;
+	if (rules) {
+		rules->lower(builder);
+	}
+	program->instructions = builder.finish();
+	program->subroutine_entries = builder.take_subroutine_entries();
+	return program;
+}
+
+static inline bool get_number(const Variant &value, double &out_value) {
+	if (value.get_type() == Variant::INT) {
+		out_value = static_cast<double>(value.operator int64_t());
+		return true;
+	} else if (value.get_type() == Variant::FLOAT) {
+		out_value = value.operator double();
+		return true;
+	}
+	return false;
+}
+
+bool RuleProgram::execute(const Variant &target, ValidationContext &context) const {
+	enum FrameKind : uint8_t {
+		FRAME_VALUE, // The root value, a property or an array item
+		FRAME_CALL, // Subroutine call, resumes at resume_pc
+		FRAME_PROPERTIES, // Property loop of an ObjectRule
+		FRAME_COMBINATOR, // Combines the results of its branches
+		FRAME_BRANCH, // Combinator branch, fail-fast unwinding stops here
+	};
+
+	// A frame is opened for every value, call and combinator the program descends into
+	struct Frame {
+		FrameKind kind = FRAME_VALUE;
+		Variant container; // Array iterated by OP_LOOP_ITEMS, keys iterated by OP_BEGIN_PROPERTIES
+		Variant values; // Values iterated by OP_BEGIN_PROPERTIES
+		Variant value; // Current value of the frame
+		int64_t index = 0;
+		int64_t size = 0;
+		bool valid = true;
+		bool segment_pushed = false;
+		bool schema_segment_pushed = false;
+		bool reference = false; // Entered through ValidationContext::enter_reference()
+		const void *memo_rules = nullptr; // Memoized (rules, container) pair of a reference call
+		uintptr_t memo_container_id = 0;
+		size_t memo_token = 0;
+		uint32_t resume_pc = 0; // Return address of calls, end instruction of branches and combinators
+
+		// Combinator state
+		const RuleInstruction *combinator = nullptr;
+		size_t error_mark = 0;
+		size_t first_failure_end = 0;
+		bool has_failure = false;
+		bool matched = false;
+		bool decided = false; // oneOf stopped early after a second match
+		std::vector<size_t> passed_indices;
+
+		// Property loop state
+		std::vector<ObjectRule::PropertyCheck> checks;
+		size_t check_index = 0;
+	};
+
+	std::vector<Frame> frames;
+	frames.reserve(8);
+
+	// Takes the value by copy, pushing can move the frame it came from
+	auto push_frame = [&frames](FrameKind kind, Variant value) -> Frame & {
+		frames.emplace_back();
+		Frame &frame = frames.back();
+		frame.kind = kind;
+		frame.value = std::move(value);
+		return frame;
+	};
+
+	// Pops the innermost frame, undoing its path segments and reference depth and recording its memo
+	auto pop_frame = [&frames, &context]() -> bool {
+		const Frame &frame = frames.back();
+		const bool valid = frame.valid;
+		if (frame.segment_pushed) {
+			context.pop_instance_segment();
+		}
+		if (frame.schema_segment_pushed) {
+			context.pop_schema_segment();
+		}
+		if (frame.memo_container_id) {
+			context.end_memo(frame.memo_rules, frame.memo_container_id, frame.memo_token, valid);
+		}
+		if (frame.reference) {
+			context.exit_reference();
+		}
+		frames.pop_back();
+		return valid;
+	};
+
+	push_frame(FRAME_VALUE, target); // Root frame, validates target directly
+
+	const Variant *current = &frames.back().value;
+	const RuleInstruction *code = instructions.data();
+	uint32_t pc = 0;
+
+	while (true) {
+		const RuleInstruction &instruction = code[pc++];
+		bool passed = true;
+
+		switch (instruction.op) {
+			case OP_CALL_RULE:
+				// The rule reports its own errors
+				if (!instruction.rule->validate(*current, context)) {
+					frames.back().valid = false;
+				}
+				break;
+
+			case OP_CHECK_TYPE:
+				passed = (SchemaUtil::get_variant_json_type_flag(*current) & static_cast<uint32_t>(instruction.int_arg)) != 0;
+				break;
+
+			case OP_MIN_LENGTH:
+			case OP_MAX_LENGTH:
+				if (current->get_type() == Variant::STRING || current->get_type() == Variant::STRING_NAME) {
+					const int64_t length = SchemaUtil::utf8_length(current->operator String());
+					passed = instruction.op == OP_MIN_LENGTH ? length >= instruction.int_arg : length <= instruction.int_arg;
+				}
+				break;
+
+			case OP_MINIMUM:
+			case OP_MAXIMUM:
+			case OP_EXCLUSIVE_MINIMUM:
+			case OP_EXCLUSIVE_MAXIMUM: {
+				double number;
+				if (get_number(*current, number)) {
+					switch (instruction.op) {
+						case OP_MINIMUM:
+							passed = number >= instruction.float_arg;
+							break;
+						case OP_MAXIMUM:
+							passed = number <= instruction.float_arg;
+							break;
+						case OP_EXCLUSIVE_MINIMUM:
+							passed = number > instruction.float_arg;
+							break;
+						default:
+							passed = number < instruction.float_arg;
+							break;
+					}
+				}
+			} break;
+
+			case OP_MIN_ITEMS:
+			case OP_MAX_ITEMS: {
+				const int64_t size = SchemaUtil::get_array_size(*current);
+				if (size >= 0) {
+					passed = instruction.op == OP_MIN_ITEMS ? size >= instruction.int_arg : size <= instruction.int_arg;
+				}
+			} break;
+
+			case OP_MIN_PROPERTIES:
+			case OP_MAX_PROPERTIES:
+				if (current->get_type() == Variant::DICTIONARY) {
+					const int64_t size = current->operator Dictionary().size();
+					passed = instruction.op == OP_MIN_PROPERTIES ? size >= instruction.int_arg : size <= instruction.int_arg;
+				}
+				break;
+
+			case OP_LOOP_ITEMS: {
+				const int64_t size = SchemaUtil::get_array_size(*current);
+				if (size <= 0) {
+					pc = instruction.jump;
+					continue;
+				}
+
+				const Variant container = *current;
+				Frame &frame = push_frame(FRAME_VALUE, SchemaUtil::get_array_item(container, 0));
+				frame.container = container;
+				frame.size = size;
+				frame.segment_pushed = context.push_instance_segment(PathSegment(static_cast<int64_t>(0)));
+				current = &frame.value;
+			}
+				continue;
+
+			case OP_NEXT_ITEM: {
+				Frame &frame = frames.back();
+				if (frame.segment_pushed) {
+					context.pop_instance_segment();
+					frame.segment_pushed = false;
+				}
+
+				if (++frame.index < frame.size) {
+					frame.value = SchemaUtil::get_array_item(frame.container, frame.index);
+					frame.segment_pushed = context.push_instance_segment(PathSegment(frame.index));
+					pc = instruction.jump;
+					continue;
+				}
+
+				if (!pop_frame()) {
+					frames.back().valid = false;
+				}
+				current = &frames.back().value;
+			}
+				continue;
+
+			case OP_BEGIN_PROPERTIES: {
+				if (current->get_type() != Variant::DICTIONARY || current->operator Dictionary().is_empty()) {
+					pc = instruction.jump;
+					continue;
+				}
+
+				const Dictionary dict = current->operator Dictionary();
+				Frame &frame = push_frame(FRAME_PROPERTIES, dict);
+				frame.container = dict.keys();
+				frame.values = dict.values();
+				frame.size = dict.size();
+				frame.index = -1;
+				current = &frame.value;
+			}
+				continue;
+
+			case OP_PROPERTY_CHECK: {
+				Frame &frame = frames.back();
+				const ObjectRule *object_rule = static_cast<const ObjectRule *>(instruction.rule);
+				const Array keys = frame.container;
+
+				// Plan the next property once every check of the current one ran
+				while (frame.check_index >= frame.checks.size() && ++frame.index < frame.size) {
+					frame.checks.clear();
+					frame.check_index = 0;
+					object_rule->plan_property(keys[frame.index], frame.checks);
+				}
+
+				if (frame.check_index >= frame.checks.size()) {
+					// Every property was checked
+					if (!pop_frame()) {
+						frames.back().valid = false;
+					}
+					current = &frames.back().value;
+					break;
+				}
+
+				const ObjectRule::PropertyCheck check = frame.checks[frame.check_index++];
+				const Variant value = check.validates_key ? keys[frame.index] : frame.values.operator Array()[frame.index];
+
+				// Resume this instruction for the next check
+				pc--;
+
+				const auto entry = subroutine_entries.find(check.rule);
+				if (entry == subroutine_entries.end()) {
+					// Disallowed additional properties, or a rule that was not lowered
+					const bool pushed = context.push_instance_segment(check.segment);
+					if (!check.rule) {
+						object_rule->report_additional_property(keys[frame.index], value, context);
+						frame.valid = false;
+					} else if (!check.rule->validate(value, context)) {
+						frame.valid = false;
+					}
+					if (pushed) {
+						context.pop_instance_segment();
+					}
+					break;
+				}
+
+				Frame &call = push_frame(FRAME_CALL, value);
+				call.segment_pushed = context.push_instance_segment(check.segment);
+				call.resume_pc = pc;
+				pc = entry->second;
+				current = &call.value;
+			}
+				continue;
+
+			case OP_CALL_REFERENCE: {
+				const RefRule *ref_rule = static_cast<const RefRule *>(instruction.rule);
+				const RuleGroup *target_rules = ref_rule->get_target_rules();
+				const uintptr_t container_id = context.is_memoizing() ? SchemaUtil::get_container_id(*current) : 0;
+				if (container_id) {
+					// Same outcomes as RefRule::validate()
+					const ValidationContext::MemoState memo = context.lookup_memo(target_rules, container_id);
+					if (memo == ValidationContext::MEMO_VALID || memo == ValidationContext::MEMO_IN_PROGRESS) {
+						break;
+					}
+					if (memo == ValidationContext::MEMO_INVALID && context.should_stop_on_failure()) {
+						frames.back().valid = false;
+						break;
+					}
+				}
+
+				if (!context.enter_reference()) {
+					ref_rule->report_depth_exceeded(*current, context);
+					frames.back().valid = false;
+					break;
+				}
+
+				Frame &frame = push_frame(FRAME_CALL, *current);
+				frame.reference = true;
+				if (container_id) {
+					frame.memo_rules = target_rules;
+					frame.memo_container_id = container_id;
+					frame.memo_token = context.begin_memo(target_rules, container_id);
+				}
+				frame.schema_segment_pushed = context.push_schema_segment(instruction.schema_segment);
+				frame.resume_pc = pc;
+				pc = instruction.jump;
+				current = &frame.value;
+			}
+				continue;
+
+			case OP_RETURN:
+				pc = frames.back().resume_pc;
+				if (!pop_frame()) {
+					frames.back().valid = false;
+				}
+				current = &frames.back().value;
+				break;
+
+			case OP_BEGIN_COMBINATOR: {
+				const size_t error_mark = context.error_count();
+				Frame &frame = push_frame(FRAME_COMBINATOR, *current);
+				frame.combinator = &instruction;
+				frame.error_mark = error_mark;
+				frame.first_failure_end = error_mark;
+				frame.resume_pc = instruction.jump;
+				current = &frame.value;
+			}
+				continue;
+
+			case OP_BEGIN_BRANCH: {
+				const bool matched = frames.back().matched;
+				if ((instruction.int_arg == BRANCH_IF_MATCHED && !matched) || (instruction.int_arg == BRANCH_IF_NOT_MATCHED && matched)) {
+					pc = instruction.jump + 1;
+					continue;
+				}
+
+				Frame &frame = push_frame(FRAME_BRANCH, *current);
+				frame.schema_segment_pushed = context.push_schema_segment(instruction.schema_segment);
+				frame.resume_pc = instruction.jump;
+				current = &frame.value;
+			}
+				continue;
+
+			case OP_END_BRANCH: {
+				// Mirrors the error handling of the combinator rules' validate()
+				const bool branch_passed = pop_frame();
+				Frame &frame = frames.back();
+				const size_t branch = static_cast<size_t>(frame.index++);
+				current = &frame.value;
+
+				switch (frame.combinator->int_arg) {
+					case COMBINATOR_ALL_OF:
+						if (!branch_passed) {
+							frame.has_failure = true;
+							if (context.should_stop_on_failure()) {
+								pc = frame.resume_pc;
+							}
+						}
+						break;
+
+					case COMBINATOR_ANY_OF:
+						if (branch_passed) {
+							context.truncate_errors(frame.error_mark);
+							frame.matched = true;
+							pc = frame.resume_pc;
+						} else if (branch == 0) {
+							// Keep only the errors from the first failed branch
+							frame.first_failure_end = context.error_count();
+						} else {
+							context.truncate_errors(frame.first_failure_end);
+						}
+						break;
+
+					case COMBINATOR_ONE_OF:
+						if (branch_passed) {
+							frame.passed_indices.push_back(branch);
+							if (frame.passed_indices.size() > 1 && context.should_stop_on_failure()) {
+								frame.decided = true;
+								pc = frame.resume_pc;
+								break;
+							}
+						} else if (!frame.has_failure) {
+							frame.has_failure = true;
+							frame.first_failure_end = context.error_count();
+							break;
+						}
+						context.truncate_errors(frame.first_failure_end);
+						break;
+
+					case COMBINATOR_NOT:
+						context.truncate_errors(frame.error_mark);
+						frame.matched = branch_passed;
+						break;
+
+					default:
+						if (branch == 0) {
+							// The "if" branch only selects "then" or "else"
+							context.truncate_errors(frame.error_mark);
+							frame.matched = branch_passed;
+						} else if (!branch_passed) {
+							frame.has_failure = true;
+						}
+						break;
+				}
+			}
+				continue;
+
+			case OP_END_COMBINATOR: {
+				Frame &frame = frames.back();
+				const ValidationRule *rule = frame.combinator->rule;
+				bool combined = true;
+
+				switch (frame.combinator->int_arg) {
+					case COMBINATOR_ALL_OF:
+						if (frame.has_failure) {
+							static_cast<const AllOfRule *>(rule)->report_failure(context);
+							combined = false;
+						}
+						break;
+
+					case COMBINATOR_ANY_OF:
+						if (!frame.matched) {
+							static_cast<const AnyOfRule *>(rule)->report_failure(frame.error_mark, context);
+							combined = false;
+						}
+						break;
+
+					case COMBINATOR_ONE_OF:
+						if (frame.decided) {
+							combined = false;
+						} else if (frame.passed_indices.empty()) {
+							static_cast<const OneOfRule *>(rule)->report_no_match(frame.error_mark, context);
+							combined = false;
+						} else {
+							context.truncate_errors(frame.error_mark);
+							if (frame.passed_indices.size() > 1) {
+								static_cast<const OneOfRule *>(rule)->report_multiple_matches(frame.passed_indices, context);
+								combined = false;
+							}
+						}
+						break;
+
+					case COMBINATOR_NOT:
+						if (frame.matched) {
+							static_cast<const NotRule *>(rule)->report_match(context);
+							combined = false;
+						}
+						break;
+
+					default:
+						combined = !frame.has_failure;
+						break;
+				}
+
+				pop_frame();
+				if (!combined) {
+					frames.back().valid = false;
+				}
+				current = &frames.back().value;
+			} break;
+
+			case OP_CHECK_PACKED: {
+				// Errors are reported by the check, so a failure is not re-run below
+				bool valid = true;
+				if (static_cast<const SelectorRule *>(instruction.rule)->validate_packed(*current, context, valid)) {
+					pc = instruction.jump;
+					if (!valid) {
+						frames.back().valid = false;
+					}
+				}
+			} break;
+
+			case OP_END_CHECK_PACKED:
+				break;
+
+			case OP_END:
+				return frames.back().valid;
+		}
+
+		if (!passed) {
+			// Re-run the originating rule so the reported error is identical to the tree walker
+			if (context.is_collecting_errors()) {
+				instruction.rule->validate(*current, context);
+			}
+			frames.back().valid = false;
+		}
+
+		if (!frames.back().valid && context.should_stop_on_failure()) {
+			// Fail fast: unwind to the innermost combinator branch, or stop. The
+			// failure propagates through every unwound frame.
+			while (frames.size() > 1 && frames.back().kind != FRAME_BRANCH) {
+				frames.back().valid = false;
+				pop_frame();
+			}
+			if (frames.back().kind != FRAME_BRANCH) {
+				return false;
+			}
+
+			frames.back().valid = false;
+			pc = frames.back().resume_pc;
+			current = &frames.back().value;
+		}
+	}
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <godot_cpp/variant/variant.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace godot {
+
+// Forward declarations
+class RuleGroup;
+class ValidationContext;
+class ValidationRule;
+
+/**
+ * @brief Instructions of a linearized rule program
+ */
+enum RuleOpCode : uint8_t {
+	OP_CALL_RULE, // Run a rule through ValidationRule::validate()
+	OP_CHECK_TYPE, // int_arg: accepted SchemaUtil::JsonTypeFlags
+	OP_MIN_LENGTH, // int_arg: minimum UTF-8 byte length
+	OP_MAX_LENGTH, // int_arg: maximum UTF-8 byte length
+	OP_MINIMUM, // float_arg: inclusive minimum
+	OP_MAXIMUM, // float_arg: inclusive maximum
+	OP_EXCLUSIVE_MINIMUM, // float_arg: exclusive minimum
+	OP_EXCLUSIVE_MAXIMUM, // float_arg: exclusive maximum
+	OP_MIN_ITEMS, // int_arg: minimum array size
+	OP_MAX_ITEMS, // int_arg: maximum array size
+	OP_MIN_PROPERTIES, // int_arg: minimum dictionary size
+	OP_MAX_PROPERTIES, // int_arg: maximum dictionary size
+	OP_LOOP_ITEMS, // Descend into the first array item, jump past the matching OP_NEXT_ITEM if there are none
+	OP_NEXT_ITEM, // Advance to the next array item and jump back to the loop body, or leave the loop
+	OP_BEGIN_PROPERTIES, // Start the property loop of an ObjectRule, jump past OP_PROPERTY_CHECK for non-objects
+	OP_PROPERTY_CHECK, // Run the next subschema that applies to a property, or leave the loop
+	OP_CALL_REFERENCE, // Call the subroutine of a $ref target, counts toward the maximum depth
+	OP_RETURN, // Return from a subroutine
+	OP_BEGIN_COMBINATOR, // int_arg: CombinatorKind, jump: matching OP_END_COMBINATOR
+	OP_BEGIN_BRANCH, // int_arg: BranchCondition, jump: matching OP_END_BRANCH
+	OP_END_BRANCH, // Feed the branch result to its combinator
+	OP_END_COMBINATOR, // Combine the branch results and report summary errors
+	OP_CHECK_PACKED, // Check a packed array in place through SelectorRule::validate_packed(), jump past OP_END_CHECK_PACKED if handled
+	OP_END_CHECK_PACKED, // End of the selection skipped by OP_CHECK_PACKED
+	OP_END, // Stop execution
+};
+
+/**
+ * @brief Combinators evaluated by OP_BEGIN_COMBINATOR
+ */
+enum CombinatorKind : uint8_t {
+	COMBINATOR_ALL_OF,
+	COMBINATOR_ANY_OF,
+	COMBINATOR_ONE_OF,
+	COMBINATOR_NOT,
+	COMBINATOR_IF, // First branch is the condition, then "then" and/or "else"
+};
+
+/**
+ * @brief Conditions under which an OP_BEGIN_BRANCH runs
+ */
+enum BranchCondition : uint8_t {
+	BRANCH_ALWAYS,
+	BRANCH_IF_MATCHED, // "then": the "if" branch passed
+	BRANCH_IF_NOT_MATCHED, // "else": the "if" branch failed
+};
+
+/**
+ * @struct RuleInstruction
+ * @brief A single instruction of a rule program
+ */
+struct RuleInstruction {
+	RuleOpCode op = OP_END;
+	uint32_t jump = 0; // Jump target for control flow instructions
+	int64_t int_arg = 0;
+	double float_arg = 0.0;
+	const ValidationRule *rule = nullptr; // Originating rule, re-run on failure so errors match the tree walker
+	String schema_segment; // Schema path segment for OP_BEGIN_BRANCH and OP_CALL_REFERENCE
+};
+
+/**
+ * @class RuleProgramBuilder
+ * @brief Collects instructions while a rule tree is lowered
+ */
+class RuleProgramBuilder {
+private:
+	std::vector<RuleInstruction> instructions;
+	std::vector<uint32_t> open_blocks; // Indices of block instructions awaiting their end
+	std::vector<const ValidationRule *> subroutines; // Rules lowered after the main program, by subroutine index
+	std::unordered_map<const ValidationRule *, uint32_t> subroutine_indices;
+	std::unordered_map<const ValidationRule *, uint32_t> subroutine_entries; // First instruction of each subroutine
+
+public:
+	/**
+	 * @brief Emits a call to a rule's validate()
+	 * @param rule The rule to call
+	 */
+	void emit_call(const ValidationRule *rule);
+
+	/**
+	 * @brief Emits an inline check instruction
+	 * @param op The check opcode
+	 * @param rule The rule the check was lowered from
+	 * @param int_arg Integer operand
+	 * @param float_arg Floating point operand
+	 */
+	void emit_check(RuleOpCode op, const ValidationRule *rule, int64_t int_arg = 0, double float_arg = 0.0);
+
+	/**
+	 * @brief Opens a block executed against every item of the current value
+	 */
+	void begin_items();
+
+	/**
+	 * @brief Closes the block opened by begin_items()
+	 */
+	void end_items();
+
+	/**
+	 * @brief Opens a block skipped when a SelectorRule checks the current packed array in place
+	 * @param rule The SelectorRule
+	 */
+	void begin_packed_check(const ValidationRule *rule);
+
+	/**
+	 * @brief Closes the block opened by begin_packed_check()
+	 */
+	void end_packed_check();
+
+	/**
+	 * @brief Emits the property loop of an ObjectRule
+	 * @param rule The ObjectRule, its subschemas must be added with add_subroutine()
+	 */
+	void emit_properties(const ValidationRule *rule);
+
+	/**
+	 * @brief Emits a call to the rules of a $ref target
+	 * @param rule The RefRule
+	 * @param target The linked target rules, lowered once as a subroutine
+	 * @param schema_segment Schema path segment of the reference
+	 */
+	void emit_reference(const ValidationRule *rule, const ValidationRule *target, const String &schema_segment);
+
+	/**
+	 * @brief Queues a rule to be lowered as a subroutine
+	 * @param rule The rule
+	 * @return Subroutine index
+	 *
+	 * Subroutines are lowered after the main program, so recursive references
+	 * become calls instead of being expanded forever.
+	 */
+	uint32_t add_subroutine(const ValidationRule *rule);
+
+	/**
+	 * @brief Opens a combinator whose branches follow
+	 * @param kind The combinator
+	 * @param rule The combinator rule, reports its summary errors
+	 */
+	void begin_combinator(CombinatorKind kind, const ValidationRule *rule);
+
+	/**
+	 * @brief Closes the block opened by begin_combinator()
+	 */
+	void end_combinator();
+
+	/**
+	 * @brief Opens a combinator branch evaluated against the current value
+	 * @param schema_segment Schema path segment of the branch (e.g. "anyOf/0")
+	 * @param condition When the branch runs
+	 */
+	void begin_branch(const String &schema_segment, BranchCondition condition = BRANCH_ALWAYS);
+
+	/**
+	 * @brief Closes the block opened by begin_branch()
+	 */
+	void end_branch();
+
+	/**
+	 * @brief Terminates the program, lowers the queued subroutines and returns the instructions
+	 * @return The instruction array
+	 */
+	std::vector<RuleInstruction> finish();
+
+	/**
+	 * @brief Gets the first instruction of every subroutine, valid after finish()
+	 * @return Map of subroutine rules to instruction indices
+	 */
+	std::unordered_map<const ValidationRule *, uint32_t> take_subroutine_entries() { return std::move(subroutine_entries); }
+};
+
+/**
+ * @class RuleProgram
+ * @brief Flat instruction form of a compiled RuleGroup
+ *
+ * Executes the same checks as the RuleGroup tree in a single dispatch loop.
+ * Keywords without a dedicated instruction fall back to OP_CALL_RULE, and
+ * failing inline checks re-run their originating rule to report the error,
+ * so results are identical to validating through the tree.
+ *
+ * Properties, "items", linked $ref targets and the combinators keep their
+ * state on an explicit frame stack instead of the native call stack, so
+ * deeply nested data validates in bounded native stack space.
+ */
+class RuleProgram {
+private:
+	std::shared_ptr<const RuleGroup> root; // Keeps the rules referenced by instructions alive
+	std::vector<RuleInstruction> instructions;
+	std::unordered_map<const ValidationRule *, uint32_t> subroutine_entries; // Entry points of subroutine rules
+
+public:
+	/**
+	 * @brief Lowers a rule tree into a program
+	 * @param rules The compiled rules
+	 * @return New program
+	 */
+	static std::shared_ptr<RuleProgram> lower(const std::shared_ptr<const RuleGroup> &rules);
+
+	/**
+	 * @brief Validates a target value by executing the program
+	 * @param target The value to validate
+	 * @param context Validation context for error tracking
+	 * @return True if validation passes
+	 */
+	bool execute(const Variant &target, ValidationContext &context) const;
+
+	/**
+	 * @brief Gets the number of instructions
+	 * @return Instruction count
+	 */
+	size_t size() const { return instructions.size(); }
+};
+
+} // namespace godot
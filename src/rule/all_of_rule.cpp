@@ -1,10 +1,12 @@
 #include "all_of_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
 
 using namespace godot;
 
 void AllOfRule::add_sub_rule(std::shared_ptr<ValidationRule> rule) {
 	if (rule) {
+		sub_rule_segments.push_back(vformat("allOf/%d", static_cast<int64_t>(sub_rules.size())));
 		sub_rules.push_back(rule);
 	}
 }
@@ -14,24 +16,38 @@ bool AllOfRule::validate(const Variant &target, ValidationContext &context) cons
 
 	// All sub-rules must pass
 	for (int64_t i = 0; i < sub_rules.size(); i++) {
-		ValidationContext sub_context = context.create_child_schema(vformat("allOf/%d", i));
+		ValidationContext::SchemaScope scope(context, sub_rule_segments[i]);
 
-		if (!sub_rules[i]->validate(target, sub_context)) {
+		if (!sub_rules[i]->validate(target, context)) {
 			all_valid = false;
+			if (context.should_stop_on_failure()) {
+				break;
+			}
 			// Continue to validate other sub-rules and collect all errors
 		}
-
-		// Merge sub-context errors into main context
-		context.merge_errors(sub_context);
 	}
 
 	if (!all_valid) {
-		context.add_error(vformat("Value failed %d out of %d allOf schemas", static_cast<int64_t>(sub_rules.size()), static_cast<int64_t>(sub_rules.size())), "allOf");
+		report_failure(context);
 	}
 
 	return all_valid;
 }
 
+void AllOfRule::report_failure(ValidationContext &context) const {
+	context.report_error("allOf", Variant(), "Value failed %d out of %d allOf schemas", static_cast<int64_t>(sub_rules.size()), static_cast<int64_t>(sub_rules.size()));
+}
+
+void AllOfRule::lower(RuleProgramBuilder &builder) const {
+	builder.begin_combinator(COMBINATOR_ALL_OF, this);
+	for (size_t i = 0; i < sub_rules.size(); i++) {
+		builder.begin_branch(sub_rule_segments[i]);
+		sub_rules[i]->lower(builder);
+		builder.end_branch();
+	}
+	builder.end_combinator();
+}
+
 String AllOfRule::get_description() const {
 	if (sub_rules.empty()) {
 		return "allOf(empty)";
@@ -19,11 +19,19 @@ class ValidationContext;
 class AllOfRule : public ValidationRule {
 private:
 	std::vector<std::shared_ptr<ValidationRule>> sub_rules;
+	std::vector<String> sub_rule_segments; // Precomputed "allOf/<index>" Schema path segments
 
 public:
 	void add_sub_rule(std::shared_ptr<ValidationRule> rule);
 
+	/**
+	 * @brief Reports the summary error after a sub-rule failed
+	 * @param context Validation context receiving the error
+	 */
+	void report_failure(ValidationContext &context) const;
+
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "allOf"; }
 	String get_description() const override;
 };
@@ -1,48 +1,66 @@
 #include "any_of_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
 
 using namespace godot;
 
 void AnyOfRule::add_sub_rule(std::shared_ptr<ValidationRule> rule) {
 	if (rule) {
+		sub_rule_segments.push_back(vformat("anyOf/%d", static_cast<int64_t>(sub_rules.size())));
 		sub_rules.push_back(rule);
 	}
 }
 
 bool AnyOfRule::validate(const Variant &target, ValidationContext &context) const {
 	if (sub_rules.empty()) {
-		context.add_error("anyOf requires at least one sub-schema", "anyOf");
+		context.report_error("anyOf", Variant(), "anyOf requires at least one sub-schema");
 		return false;
 	}
 
 	// At least one sub-rule must pass
-	bool any_passed = false;
-	std::vector<ValidationContext> failed_contexts;
+	const size_t error_mark = context.error_count();
+	size_t first_failure_end = error_mark;
 
 	for (int64_t i = 0; i < sub_rules.size(); i++) {
-		ValidationContext sub_context = context.create_child_schema(vformat("anyOf/%d", i));
+		{
+			ValidationContext::SchemaScope scope(context, sub_rule_segments[i]);
+			if (sub_rules[i]->validate(target, context)) {
+				context.truncate_errors(error_mark);
+				return true; // Success - we can stop here
+			}
+		}
 
-		if (sub_rules[i]->validate(target, sub_context)) {
-			any_passed = true;
-			break; // Success - we can stop here
+		// Keep only the errors from the first failed schema for debugging
+		// (but don't overwhelm with all of them)
+		if (i == 0) {
+			first_failure_end = context.error_count();
 		} else {
-			failed_contexts.push_back(sub_context);
+			context.truncate_errors(first_failure_end);
 		}
 	}
 
-	if (!any_passed) {
-		context.add_error(vformat("Value failed all %d anyOf schemas", static_cast<int64_t>(sub_rules.size())), "anyOf");
+	report_failure(error_mark, context);
+	return false;
+}
 
-		// Optionally merge some failed context errors for debugging
-		// (but don't overwhelm with all of them)
-		if (!failed_contexts.empty()) {
-			context.merge_errors(failed_contexts[0]); // Show errors from first failed schema
-		}
+void AnyOfRule::report_failure(size_t error_mark, ValidationContext &context) const {
+	context.report_error_at(error_mark, "anyOf", Variant(), "Value failed all %d anyOf schemas", static_cast<int64_t>(sub_rules.size()));
+}
 
-		return false;
+void AnyOfRule::lower(RuleProgramBuilder &builder) const {
+	// The empty case only reports an error
+	if (sub_rules.empty()) {
+		builder.emit_call(this);
+		return;
 	}
 
-	return true;
+	builder.begin_combinator(COMBINATOR_ANY_OF, this);
+	for (size_t i = 0; i < sub_rules.size(); i++) {
+		builder.begin_branch(sub_rule_segments[i]);
+		sub_rules[i]->lower(builder);
+		builder.end_branch();
+	}
+	builder.end_combinator();
 }
 
 String AnyOfRule::get_description() const {
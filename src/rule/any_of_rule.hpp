@@ -19,11 +19,20 @@ class ValidationContext;
 class AnyOfRule : public ValidationRule {
 private:
 	std::vector<std::shared_ptr<ValidationRule>> sub_rules;
+	std::vector<String> sub_rule_segments; // Precomputed "anyOf/<index>" Schema path segments
 
 public:
 	void add_sub_rule(std::shared_ptr<ValidationRule> rule);
 
+	/**
+	 * @brief Reports the summary error after every sub-rule failed
+	 * @param error_mark Error count before the first sub-rule ran, the summary is inserted there
+	 * @param context Validation context receiving the error
+	 */
+	void report_failure(size_t error_mark, ValidationContext &context) const;
+
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "anyOf"; }
 	String get_description() const override;
 };
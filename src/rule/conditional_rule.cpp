@@ -1,26 +1,30 @@
 #include "conditional_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
 
 using namespace godot;
 
 bool ConditionalRule::validate(const Variant &target, ValidationContext &context) const {
 	if (!if_rule) {
-		context.add_error("Conditional rule missing 'if' schema", "conditional");
+		context.report_error("conditional", Variant(), "Conditional rule missing 'if' schema");
 		return false;
 	}
 
-	// Create a temporary context to test the 'if' condition
+	// Test the 'if' condition, discarding its errors
 	// We don't want to propagate errors from the 'if' test to the main context
-	ValidationContext if_context = context.create_child_schema("if");
-	bool if_result = if_rule->validate(target, if_context);
+	const size_t error_mark = context.error_count();
+	bool if_result;
+	{
+		ValidationContext::SchemaScope scope(context, "if");
+		if_result = if_rule->validate(target, context);
+	}
+	context.truncate_errors(error_mark);
 
 	if (if_result) {
 		// 'if' condition passed, validate against 'then' schema
 		if (then_rule) {
-			ValidationContext then_context = context.create_child_schema("then");
-			bool then_result = then_rule->validate(target, then_context);
-			if (!then_result) {
-				context.merge_errors(then_context);
+			ValidationContext::SchemaScope scope(context, "then");
+			if (!then_rule->validate(target, context)) {
 				return false;
 			}
 		}
@@ -29,10 +33,8 @@ bool ConditionalRule::validate(const Variant &target, ValidationContext &context
 	} else {
 		// 'if' condition failed, validate against 'else' schema
 		if (else_rule) {
-			ValidationContext else_context = context.create_child_schema("else");
-			bool else_result = else_rule->validate(target, else_context);
-			if (!else_result) {
-				context.merge_errors(else_context);
+			ValidationContext::SchemaScope scope(context, "else");
+			if (!else_rule->validate(target, context)) {
 				return false;
 			}
 		}
@@ -41,6 +43,30 @@ bool ConditionalRule::validate(const Variant &target, ValidationContext &context
 	}
 }
 
+void ConditionalRule::lower(RuleProgramBuilder &builder) const {
+	// The missing 'if' case only reports an error
+	if (!if_rule) {
+		builder.emit_call(this);
+		return;
+	}
+
+	builder.begin_combinator(COMBINATOR_IF, this);
+	builder.begin_branch("if");
+	if_rule->lower(builder);
+	builder.end_branch();
+	if (then_rule) {
+		builder.begin_branch("then", BRANCH_IF_MATCHED);
+		then_rule->lower(builder);
+		builder.end_branch();
+	}
+	if (else_rule) {
+		builder.begin_branch("else", BRANCH_IF_NOT_MATCHED);
+		else_rule->lower(builder);
+		builder.end_branch();
+	}
+	builder.end_combinator();
+}
+
 String ConditionalRule::get_description() const {
 	String desc = "conditional(if: ";
 	if (if_rule) {
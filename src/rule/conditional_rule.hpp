@@ -28,6 +28,7 @@ public:
 			else_rule(else_schema) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "conditional"; }
 	String get_description() const override;
 };
@@ -11,13 +11,13 @@ bool ContainsRule::validate(const Variant &target, ValidationContext &context) c
 	}
 
 	if (array_size == 0) {
-		context.add_error("Empty array cannot contain any items", "contains", target);
+		context.report_error("contains", target, "Empty array cannot contain any items");
 		return false;
 	}
 
 	// Handle case where there's no sub-rule (shouldn't happen in normal flow)
 	if (!item_rule) {
-		context.add_error("Array does not contain any item matching the required schema", "contains", target);
+		context.report_error("contains", target, "Array does not contain any item matching the required schema");
 		return false;
 	}
 
@@ -29,22 +29,23 @@ bool ContainsRule::validate(const Variant &target, ValidationContext &context) c
 
 	// Normal case: check if at least one item validates against the schema
 	bool found_match = false;
+	const size_t error_mark = context.error_count();
 
 	for (int64_t i = 0; i < array_size; i++) {
 		Variant item = SchemaUtil::get_array_item(target, i);
 
-		// Create a temporary context for this item
 		// We don't want to propagate errors from failed attempts to the main context
-		ValidationContext item_context = context.create_child_instance(String::num(i));
+		ValidationContext::InstanceScope scope(context, PathSegment(i));
+		found_match = item_rule->validate(item, context);
+		context.truncate_errors(error_mark);
 
-		if (item_rule->validate(item, item_context)) {
-			found_match = true;
+		if (found_match) {
 			break; // Success - we found at least one matching item
 		}
 	}
 
 	if (!found_match) {
-		context.add_error(vformat("Array with %d items does not contain any item matching the required schema", array_size), "contains", target);
+		context.report_error("contains", target, "Array with %d items does not contain any item matching the required schema", array_size);
 		return false;
 	}
 
@@ -26,6 +26,7 @@ public:
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
 	String get_rule_type() const override { return "contains"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override;
 };
 
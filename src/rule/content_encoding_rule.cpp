@@ -47,21 +47,21 @@ bool ContentEncodingRule::validate_base64(const String &str, ValidationContext &
 			padding_started = true;
 			padding_count++;
 			if (padding_count > 2) {
-				context.add_error("Base64 content has too much padding", "contentEncoding", str);
+				context.report_error("contentEncoding", str, "Base64 content has too much padding");
 				return false;
 			}
 		} else if (padding_started) {
-			context.add_error("Base64 content has characters after padding", "contentEncoding", str);
+			context.report_error("contentEncoding", str, "Base64 content has characters after padding");
 			return false;
 		} else if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '+' || c == '/')) {
-			context.add_error(vformat("Base64 content contains invalid character: '%c'", c), "contentEncoding", str);
+			context.report_error("contentEncoding", str, "Base64 content contains invalid character: '%c'", c);
 			return false;
 		}
 	}
 
 	// Check length is multiple of 4
 	if (str.length() % 4 != 0) {
-		context.add_error("Base64 content length must be multiple of 4", "contentEncoding", str);
+		context.report_error("contentEncoding", str, "Base64 content length must be multiple of 4");
 		return false;
 	}
 
@@ -77,7 +77,7 @@ bool ContentEncodingRule::validate_base64url(const String &str, ValidationContex
 	for (int i = 0; i < str.length(); i++) {
 		char c = str[i];
 		if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_')) {
-			context.add_error(vformat("Base64url content contains invalid character: '%c'", c), "contentEncoding", str);
+			context.report_error("contentEncoding", str, "Base64url content contains invalid character: '%c'", c);
 			return false;
 		}
 	}
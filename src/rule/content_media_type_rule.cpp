@@ -30,13 +30,13 @@ String ContentMediaTypeRule::get_description() const {
 
 bool ContentMediaTypeRule::validate_json(const String &str, ValidationContext &context) const {
 	if (str.is_empty()) {
-		context.add_error("JSON content cannot be empty", "contentMediaType", str);
+		context.report_error("contentMediaType", str, "JSON content cannot be empty");
 		return false;
 	}
 
 	Variant result = JSON::parse_string(str);
 	if (result.get_type() == Variant::NIL) {
-		context.add_error("Invalid JSON content", "contentMediaType", str);
+		context.report_error("contentMediaType", str, "Invalid JSON content");
 		return false;
 	}
 
@@ -45,19 +45,19 @@ bool ContentMediaTypeRule::validate_json(const String &str, ValidationContext &c
 
 bool ContentMediaTypeRule::validate_xml(const String &str, ValidationContext &context) const {
 	if (str.is_empty()) {
-		context.add_error("XML content cannot be empty", "contentMediaType", str);
+		context.report_error("contentMediaType", str, "XML content cannot be empty");
 		return false;
 	}
 
 	// Basic XML validation - check for balanced tags
 	// This is a simplified validation; a full XML parser would be better
 	if (!str.strip_edges().begins_with("<")) {
-		context.add_error("XML content must start with '<'", "contentMediaType", str);
+		context.report_error("contentMediaType", str, "XML content must start with '<'");
 		return false;
 	}
 
 	if (!str.strip_edges().ends_with(">")) {
-		context.add_error("XML content must end with '>'", "contentMediaType", str);
+		context.report_error("contentMediaType", str, "XML content must end with '>'");
 		return false;
 	}
 
@@ -18,6 +18,7 @@ public:
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
 	String get_rule_type() const override { return "contentMediaType"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_STRING; }
 	String get_description() const override;
 
 private:
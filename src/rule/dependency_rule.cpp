@@ -17,15 +17,12 @@ bool DependencyRule::validate(const Variant &target, ValidationContext &context)
 	if (is_schema_dependency) {
 		// Schema dependency: validate entire object against dependency schema
 		if (!dependency_schema) {
-			context.add_error(vformat("Schema dependency for '%s' is not defined", trigger_property), "dependencies");
+			context.report_error("dependencies", Variant(), "Schema dependency for '%s' is not defined", trigger_property);
 			return false;
 		}
 
-		ValidationContext dep_context = context.create_child_schema(vformat("dependencies/%s", trigger_property));
-
-		bool result = dependency_schema->validate(target, dep_context);
-		context.merge_errors(dep_context);
-		return result;
+		ValidationContext::SchemaScope scope(context, schema_path_segment);
+		return dependency_schema->validate(target, context);
 
 	} else {
 		// Property dependency: check required properties exist
@@ -34,8 +31,11 @@ bool DependencyRule::validate(const Variant &target, ValidationContext &context)
 		for (const String &required_prop : required_properties) {
 			StringName prop_name = StringName(required_prop);
 			if (!dict.has(prop_name)) {
-				context.add_error(vformat("Property '%s' is required when '%s' is present", required_prop, trigger_property), "dependencies");
+				context.report_error("dependencies", Variant(), "Property '%s' is required when '%s' is present", required_prop, trigger_property);
 				all_present = false;
+				if (context.should_stop_on_failure()) {
+					break;
+				}
 			}
 		}
 
@@ -18,6 +18,7 @@ class ValidationContext;
 class DependencyRule : public ValidationRule {
 private:
 	StringName trigger_property;
+	String schema_path_segment; // Precomputed "dependencies/<trigger>" Schema path segment
 	std::vector<String> required_properties; // For property dependencies
 	std::shared_ptr<ValidationRule> dependency_schema; // For schema dependencies
 	bool is_schema_dependency;
@@ -32,11 +33,13 @@ public:
 	// Constructor for schema dependencies
 	DependencyRule(const StringName &trigger, std::shared_ptr<ValidationRule> schema) :
 			trigger_property(trigger),
+			schema_path_segment(vformat("dependencies/%s", trigger)),
 			dependency_schema(schema),
 			is_schema_dependency(true) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
 	String get_rule_type() const override { return "dependency"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_OBJECT; }
 	String get_description() const override;
 };
 
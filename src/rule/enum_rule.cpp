@@ -1,9 +1,39 @@
 #include "enum_rule.hpp"
 #include "../validation_context.hpp"
+#include "string_constraints.hpp"
 
 using namespace godot;
 
+EnumRule::EnumRule(const Array &values) :
+		allowed_values(values) {
+	for (int64_t i = 0; i < allowed_values.size(); i++) {
+		const Variant &value = allowed_values[i];
+		switch (value.get_type()) {
+			case Variant::STRING:
+			case Variant::STRING_NAME:
+				string_values.insert(value.operator String());
+				break;
+			case Variant::NIL:
+			case Variant::BOOL:
+			case Variant::INT:
+			case Variant::FLOAT:
+			case Variant::ARRAY:
+			case Variant::DICTIONARY:
+				break; // Never equal to a String
+			default:
+				string_values_complete = false;
+				break;
+		}
+	}
+}
+
 bool EnumRule::validate(const Variant &target, ValidationContext &context) const {
+	// Strings are looked up by hash
+	if ((target.get_type() == Variant::STRING || target.get_type() == Variant::STRING_NAME) &&
+			string_values.find(target.operator String()) != string_values.end()) {
+		return true;
+	}
+
 	// Check if target matches any of the allowed values
 	for (int i = 0; i < allowed_values.size(); i++) {
 		if (target == allowed_values[i]) {
@@ -11,17 +41,11 @@ bool EnumRule::validate(const Variant &target, ValidationContext &context) const
 		}
 	}
 
-	// No match found - build error message
-	String target_str = target.stringify();
-	String allowed_str;
-	for (int i = 0; i < allowed_values.size(); i++) {
-		if (i > 0) {
-			allowed_str += ", ";
-		}
-		allowed_str += allowed_values[i].stringify();
+	if (!context.is_collecting_errors()) {
+		return false;
 	}
 
-	context.add_error(vformat("Value %s is not one of the allowed values: %s", target_str, allowed_str), "enum", target);
+	context.report_error("enum", target, "Value %s is not one of the allowed values: %s", ValidationError::MessageData{ target }, ValidationError::MessageList{ allowed_values });
 
 	return false;
 }
@@ -37,3 +61,12 @@ String EnumRule::get_description() const {
 	desc += ")";
 	return desc;
 }
+
+bool EnumRule::narrow_string_constraints(StringConstraints &constraints) const {
+	// A second "enum" would need the intersection, leave it to validate()
+	if (!string_values_complete || constraints.allowed_values) {
+		return false;
+	}
+	constraints.allowed_values = &string_values;
+	return true;
+}
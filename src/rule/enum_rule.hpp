@@ -1,9 +1,12 @@
 #pragma once
 
+#include "../hashers.hpp"
 #include "validation_rule.hpp"
 
 #include <godot_cpp/variant/variant.hpp>
 
+#include <unordered_set>
+
 namespace godot {
 
 // Forward declarations
@@ -16,12 +19,14 @@ class ValidationContext;
 class EnumRule : public ValidationRule {
 private:
 	Array allowed_values;
+	std::unordered_set<String, StringHasher> string_values; // String and StringName members, hashed for lookups
+	bool string_values_complete = true; // False if a member of another type could equal a String
 
 public:
-	explicit EnumRule(const Array &values) :
-			allowed_values(values) {}
+	explicit EnumRule(const Array &values);
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
 	String get_rule_type() const override { return "enum"; }
 	String get_description() const override;
 };
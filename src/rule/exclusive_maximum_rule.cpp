@@ -1,4 +1,6 @@
 #include "exclusive_maximum_rule.hpp"
+#include "../program/rule_program.hpp"
+#include "numeric_range.hpp"
 
 using namespace godot;
 
@@ -15,9 +17,18 @@ bool ExclusiveMaximumRule::validate(const Variant &target, ValidationContext &co
 	}
 
 	if (actual_value >= exclusive_maximum) {
-		context.add_error(vformat("Value %f is not less than exclusive maximum %f", actual_value, exclusive_maximum), "exclusiveMaximum", target);
+		context.report_error("exclusiveMaximum", target, "Value %f is not less than exclusive maximum %f", actual_value, exclusive_maximum);
 		return false;
 	}
 
 	return true;
 }
+
+void ExclusiveMaximumRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_EXCLUSIVE_MAXIMUM, this, 0, exclusive_maximum);
+}
+
+bool ExclusiveMaximumRule::narrow_numeric_range(NumericRange &range) const {
+	range.exclusive_maximum = std::min(range.exclusive_maximum, exclusive_maximum);
+	return true;
+}
@@ -18,7 +18,10 @@ public:
 			exclusive_maximum(max) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
+	bool narrow_numeric_range(NumericRange &range) const override;
 	String get_rule_type() const override { return "exclusiveMaximum"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_NUMERIC; }
 	String get_description() const override { return vformat("exclusiveMaximum(%f)", exclusive_maximum); }
 };
 
@@ -1,4 +1,6 @@
 #include "exclusive_minimum_rule.hpp"
+#include "../program/rule_program.hpp"
+#include "numeric_range.hpp"
 
 using namespace godot;
 
@@ -15,9 +17,18 @@ bool ExclusiveMinimumRule::validate(const Variant &target, ValidationContext &co
 	}
 
 	if (actual_value <= exclusive_minimum) {
-		context.add_error(vformat("Value %f is not greater than exclusive minimum %f", actual_value, exclusive_minimum), "exclusiveMinimum", target);
+		context.report_error("exclusiveMinimum", target, "Value %f is not greater than exclusive minimum %f", actual_value, exclusive_minimum);
 		return false;
 	}
 
 	return true;
 }
+
+void ExclusiveMinimumRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_EXCLUSIVE_MINIMUM, this, 0, exclusive_minimum);
+}
+
+bool ExclusiveMinimumRule::narrow_numeric_range(NumericRange &range) const {
+	range.exclusive_minimum = std::max(range.exclusive_minimum, exclusive_minimum);
+	return true;
+}
@@ -4,6 +4,6 @@
 using namespace godot;
 
 bool FalseRule::validate(const Variant &target, ValidationContext &context) const {
-	context.add_error("Value is not allowed by schema: false", "false", target);
+	context.report_error("false", target, "Value is not allowed by schema: false");
 	return false; // Always fails
 }
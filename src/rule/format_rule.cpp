@@ -1,5 +1,6 @@
 #include "format_rule.hpp"
 #include "../validation_context.hpp"
+#include "string_constraints.hpp"
 
 #include <godot_cpp/classes/json.hpp>
 #include <godot_cpp/classes/reg_ex.hpp>
@@ -13,8 +14,10 @@ bool FormatRule::validate(const Variant &target, ValidationContext &context) con
 		return true; // Format is ignored for non-strings
 	}
 
-	const String str = target.operator String();
+	return validate_string(target.operator String(), context);
+}
 
+bool FormatRule::validate_string(const String &str, ValidationContext &context) const {
 	if (format == "date-time") {
 		return validate_date_time(str, context);
 	} else if (format == "date") {
@@ -61,13 +64,13 @@ String FormatRule::get_description() const {
 bool FormatRule::validate_regex(const String &regex_pattern, const String &str, ValidationContext &context) const {
 	Ref<RegEx> regex = RegEx::create_from_string(regex_pattern);
 	if (!regex.is_valid()) {
-		context.add_error(vformat("Invalid %s regex: \"%s\"", format, regex_pattern), "format", str);
+		context.report_error("format", str, "Invalid %s regex: \"%s\"", format, regex_pattern);
 		return false;
 	}
 
 	Ref<RegExMatch> match = regex->search(str);
 	if (!match.is_valid()) {
-		context.add_error(vformat("Invalid %s: \"%s\"", format, str), "format", str);
+		context.report_error("format", str, "Invalid %s: \"%s\"", format, str);
 		return false;
 	}
 
@@ -77,20 +80,20 @@ bool FormatRule::validate_regex(const String &regex_pattern, const String &str,
 bool FormatRule::validate_email(const String &str, ValidationContext &context) const {
 	// Check for consecutive dots
 	if (str.contains("..")) {
-		context.add_error(vformat("Email cannot contain consecutive dots: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Email cannot contain consecutive dots: \"%s\"", str);
 		return false;
 	}
 
 	// Check for leading/trailing dots in local part
 	int at_pos = str.find("@");
 	if (at_pos == -1) {
-		context.add_error(vformat("Email must contain @: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Email must contain @: \"%s\"", str);
 		return false;
 	}
 
 	String local_part = str.substr(0, at_pos);
 	if (local_part.begins_with(".") || local_part.ends_with(".")) {
-		context.add_error(vformat("Email local part cannot start or end with dot: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Email local part cannot start or end with dot: \"%s\"", str);
 		return false;
 	}
 
@@ -104,19 +107,19 @@ bool FormatRule::validate_date(const String &str, ValidationContext &context) co
 	const String date_pattern = "^([0-9]{4})-([0-9]{2})-([0-9]{2})$";
 	Ref<RegEx> regex = RegEx::create_from_string(date_pattern);
 	if (!regex.is_valid()) {
-		context.add_error("Internal error: invalid date regex", "format", str);
+		context.report_error("format", str, "Internal error: invalid date regex");
 		return false;
 	}
 
 	Ref<RegExMatch> match = regex->search(str);
 	if (!match.is_valid()) {
-		context.add_error(vformat("Invalid date format: \"%s\" (expected YYYY-MM-DD)", str), "format", str);
+		context.report_error("format", str, "Invalid date format: \"%s\" (expected YYYY-MM-DD)", str);
 		return false;
 	}
 
 	PackedStringArray groups = match->get_strings();
 	if (groups.size() < 4) {
-		context.add_error("Internal error: date regex groups", "format", str);
+		context.report_error("format", str, "Internal error: date regex groups");
 		return false;
 	}
 
@@ -126,12 +129,12 @@ bool FormatRule::validate_date(const String &str, ValidationContext &context) co
 
 	// Validate ranges
 	if (month < 1 || month > 12) {
-		context.add_error(vformat("Month must be 1-12, got %d", month), "format", str);
+		context.report_error("format", str, "Month must be 1-12, got %d", month);
 		return false;
 	}
 
 	if (day < 1 || day > 31) {
-		context.add_error(vformat("Day must be 1-31, got %d", day), "format", str);
+		context.report_error("format", str, "Day must be 1-31, got %d", day);
 		return false;
 	}
 
@@ -144,7 +147,7 @@ bool FormatRule::validate_date(const String &str, ValidationContext &context) co
 	}
 
 	if (day > max_day) {
-		context.add_error(vformat("Day %d is invalid for month %d in year %d", day, month, year), "format", str);
+		context.report_error("format", str, "Day %d is invalid for month %d in year %d", day, month, year);
 		return false;
 	}
 
@@ -157,19 +160,19 @@ bool FormatRule::validate_time(const String &str, ValidationContext &context) co
 			"^([0-9]{2}):([0-9]{2}):([0-9]{2})(?:\\.([0-9]+))?(?:([Zz])|([+-])([0-9]{2}):([0-9]{2}))?$";
 	Ref<RegEx> regex = RegEx::create_from_string(time_pattern);
 	if (!regex.is_valid()) {
-		context.add_error("Internal error: invalid time regex", "format", str);
+		context.report_error("format", str, "Internal error: invalid time regex");
 		return false;
 	}
 
 	Ref<RegExMatch> match = regex->search(str);
 	if (!match.is_valid()) {
-		context.add_error(vformat("Invalid time format: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Invalid time format: \"%s\"", str);
 		return false;
 	}
 
 	PackedStringArray groups = match->get_strings();
 	if (groups.size() < 4) {
-		context.add_error("Internal error: time regex groups", "format", str);
+		context.report_error("format", str, "Internal error: time regex groups");
 		return false;
 	}
 
@@ -178,17 +181,17 @@ bool FormatRule::validate_time(const String &str, ValidationContext &context) co
 	int second = groups[3].to_int();
 
 	if (hour < 0 || hour > 23) {
-		context.add_error(vformat("Hour must be 0-23, got %d", hour), "format", str);
+		context.report_error("format", str, "Hour must be 0-23, got %d", hour);
 		return false;
 	}
 
 	if (minute < 0 || minute > 59) {
-		context.add_error(vformat("Minute must be 0-59, got %d", minute), "format", str);
+		context.report_error("format", str, "Minute must be 0-59, got %d", minute);
 		return false;
 	}
 
 	if (second < 0 || second > 59) {
-		context.add_error(vformat("Second must be 0-59, got %d", second), "format", str);
+		context.report_error("format", str, "Second must be 0-59, got %d", second);
 		return false;
 	}
 
@@ -198,12 +201,12 @@ bool FormatRule::validate_time(const String &str, ValidationContext &context) co
 		int tz_minute = groups[8].to_int();
 
 		if (tz_hour < 0 || tz_hour > 23) {
-			context.add_error(vformat("Timezone hour must be 0-23, got %d", tz_hour), "format", str);
+			context.report_error("format", str, "Timezone hour must be 0-23, got %d", tz_hour);
 			return false;
 		}
 
 		if (tz_minute < 0 || tz_minute > 59) {
-			context.add_error(vformat("Timezone minute must be 0-59, got %d", tz_minute), "format", str);
+			context.report_error("format", str, "Timezone minute must be 0-59, got %d", tz_minute);
 			return false;
 		}
 	}
@@ -217,19 +220,19 @@ bool FormatRule::validate_date_time(const String &str, ValidationContext &contex
 							  "([Zz])|([+-])([0-9]{2}):([0-9]{2}))?$";
 	Ref<RegEx> regex = RegEx::create_from_string(dt_pattern);
 	if (!regex.is_valid()) {
-		context.add_error("Internal error: invalid date-time regex", "format", str);
+		context.report_error("format", str, "Internal error: invalid date-time regex");
 		return false;
 	}
 
 	Ref<RegExMatch> match = regex->search(str);
 	if (!match.is_valid()) {
-		context.add_error(vformat("Invalid date-time format: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Invalid date-time format: \"%s\"", str);
 		return false;
 	}
 
 	PackedStringArray groups = match->get_strings();
 	if (groups.size() < 7) {
-		context.add_error("Internal error: date-time regex groups", "format", str);
+		context.report_error("format", str, "Internal error: date-time regex groups");
 		return false;
 	}
 
@@ -245,17 +248,17 @@ bool FormatRule::validate_date_time(const String &str, ValidationContext &contex
 	int second = groups[6].to_int();
 
 	if (hour < 0 || hour > 23) {
-		context.add_error(vformat("Hour must be 0-23, got %d", hour), "format", str);
+		context.report_error("format", str, "Hour must be 0-23, got %d", hour);
 		return false;
 	}
 
 	if (minute < 0 || minute > 59) {
-		context.add_error(vformat("Minute must be 0-59, got %d", minute), "format", str);
+		context.report_error("format", str, "Minute must be 0-59, got %d", minute);
 		return false;
 	}
 
 	if (second < 0 || second > 59) {
-		context.add_error(vformat("Second must be 0-59, got %d", second), "format", str);
+		context.report_error("format", str, "Second must be 0-59, got %d", second);
 		return false;
 	}
 
@@ -265,12 +268,12 @@ bool FormatRule::validate_date_time(const String &str, ValidationContext &contex
 		int tz_minute = groups[11].to_int();
 
 		if (tz_hour < 0 || tz_hour > 23) {
-			context.add_error(vformat("Timezone hour must be 0-23, got %d", tz_hour), "format", str);
+			context.report_error("format", str, "Timezone hour must be 0-23, got %d", tz_hour);
 			return false;
 		}
 
 		if (tz_minute < 0 || tz_minute > 59) {
-			context.add_error(vformat("Timezone minute must be 0-59, got %d", tz_minute), "format", str);
+			context.report_error("format", str, "Timezone minute must be 0-59, got %d", tz_minute);
 			return false;
 		}
 	}
@@ -281,7 +284,7 @@ bool FormatRule::validate_date_time(const String &str, ValidationContext &contex
 bool FormatRule::validate_ipv4(const String &str, ValidationContext &context) const {
 	PackedStringArray octets = str.split(".");
 	if (octets.size() != 4) {
-		context.add_error(vformat("IPv4 address must have exactly 4 octets, got %d", static_cast<int64_t>(octets.size())), "format", str);
+		context.report_error("format", str, "IPv4 address must have exactly 4 octets, got %d", static_cast<int64_t>(octets.size()));
 		return false;
 	}
 
@@ -290,19 +293,19 @@ bool FormatRule::validate_ipv4(const String &str, ValidationContext &context) co
 
 		// Check for leading zeros (except "0" itself)
 		if (octet.length() > 1 && octet[0] == '0') {
-			context.add_error(vformat("IPv4 octet cannot have leading zeros: \"%s\"", octet), "format", str);
+			context.report_error("format", str, "IPv4 octet cannot have leading zeros: \"%s\"", octet);
 			return false;
 		}
 
 		// Must be numeric
 		if (!octet.is_valid_int()) {
-			context.add_error(vformat("IPv4 octet must be numeric: \"%s\"", octet), "format", str);
+			context.report_error("format", str, "IPv4 octet must be numeric: \"%s\"", octet);
 			return false;
 		}
 
 		int value = octet.to_int();
 		if (value < 0 || value > 255) {
-			context.add_error(vformat("IPv4 octet must be 0-255, got %d", value), "format", str);
+			context.report_error("format", str, "IPv4 octet must be 0-255, got %d", value);
 			return false;
 		}
 	}
@@ -313,7 +316,7 @@ bool FormatRule::validate_ipv4(const String &str, ValidationContext &context) co
 bool FormatRule::validate_ipv6(const String &str, ValidationContext &context) const {
 	// Check for double :: (invalid)
 	if (str.count("::") > 1) {
-		context.add_error("IPv6 address cannot contain multiple '::'", "format", str);
+		context.report_error("format", str, "IPv6 address cannot contain multiple '::'");
 		return false;
 	}
 
@@ -336,14 +339,14 @@ bool FormatRule::validate_ipv6(const String &str, ValidationContext &context) co
 	if (str.contains("::")) {
 		parts = str.split("::", false);
 		if (parts.size() > 2) {
-			context.add_error("IPv6 address has invalid :: usage", "format", str);
+			context.report_error("format", str, "IPv6 address has invalid :: usage");
 			return false;
 		}
 	} else {
 		// No compression - should have exactly 8 groups
 		PackedStringArray groups = str.split(":");
 		if (groups.size() != 8) {
-			context.add_error(vformat("IPv6 address without :: must have exactly 8 groups, got %d", static_cast<int64_t>(groups.size())), "format", str);
+			context.report_error("format", str, "IPv6 address without :: must have exactly 8 groups, got %d", static_cast<int64_t>(groups.size()));
 			return false;
 		}
 		parts.push_back(str);
@@ -368,7 +371,7 @@ bool FormatRule::validate_ipv6(const String &str, ValidationContext &context) co
 
 			// Each group must be 1-4 hex digits
 			if (group.length() > 4) {
-				context.add_error(vformat("IPv6 group cannot be longer than 4 characters: \"%s\"", group), "format", str);
+				context.report_error("format", str, "IPv6 group cannot be longer than 4 characters: \"%s\"", group);
 				return false;
 			}
 
@@ -376,7 +379,7 @@ bool FormatRule::validate_ipv6(const String &str, ValidationContext &context) co
 			for (int j = 0; j < group.length(); j++) {
 				char c = group[j];
 				if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
-					context.add_error(vformat("IPv6 group contains invalid hex character: \"%s\"", group), "format", str);
+					context.report_error("format", str, "IPv6 group contains invalid hex character: \"%s\"", group);
 					return false;
 				}
 			}
@@ -391,7 +394,7 @@ bool FormatRule::validate_ipv6_with_ipv4(const String &str, ValidationContext &c
 
 	int last_colon = str.rfind(":");
 	if (last_colon == -1) {
-		context.add_error("Invalid IPv6 with IPv4 format", "format", str);
+		context.report_error("format", str, "Invalid IPv6 with IPv4 format");
 		return false;
 	}
 
@@ -423,7 +426,7 @@ bool FormatRule::validate_ipv6_with_ipv4(const String &str, ValidationContext &c
 	int estimated_groups = colon_count + 1 - 2; // -2 for the IPv4 part taking 2 groups
 
 	if (!has_compression && estimated_groups != 6) {
-		context.add_error("IPv6 with embedded IPv4 must have 6 IPv6 groups", "format", str);
+		context.report_error("format", str, "IPv6 with embedded IPv4 must have 6 IPv6 groups");
 		return false;
 	}
 
@@ -433,7 +436,7 @@ bool FormatRule::validate_ipv6_with_ipv4(const String &str, ValidationContext &c
 bool FormatRule::validate_uri(const String &str, ValidationContext &context) const {
 	// URI must have a scheme
 	if (!str.contains(":")) {
-		context.add_error("URI must contain a scheme (e.g., \"http:\")", "format", str);
+		context.report_error("format", str, "URI must contain a scheme (e.g., \"http:\")");
 		return false;
 	}
 
@@ -443,7 +446,7 @@ bool FormatRule::validate_uri(const String &str, ValidationContext &context) con
 
 	// Scheme must not be empty and must start with letter
 	if (scheme.is_empty()) {
-		context.add_error("URI scheme cannot be empty", "format", str);
+		context.report_error("format", str, "URI scheme cannot be empty");
 		return false;
 	}
 
@@ -455,7 +458,7 @@ bool FormatRule::validate_uri(const String &str, ValidationContext &context) con
 	// Check that we have content after the scheme
 	String remainder = str.substr(colon_pos + 1);
 	if (remainder.is_empty()) {
-		context.add_error("URI must have content after scheme", "format", str);
+		context.report_error("format", str, "URI must have content after scheme");
 		return false;
 	}
 
@@ -476,7 +479,7 @@ bool FormatRule::validate_json_pointer(const String &str, ValidationContext &con
 	}
 
 	if (!str.begins_with("/")) {
-		context.add_error("JSON Pointer must start with '/' or be empty", "format", str);
+		context.report_error("format", str, "JSON Pointer must start with '/' or be empty");
 		return false;
 	}
 
@@ -484,12 +487,12 @@ bool FormatRule::validate_json_pointer(const String &str, ValidationContext &con
 	for (int i = 0; i < str.length(); i++) {
 		if (str[i] == '~') {
 			if (i + 1 >= str.length()) {
-				context.add_error("JSON Pointer has incomplete escape sequence", "format", str);
+				context.report_error("format", str, "JSON Pointer has incomplete escape sequence");
 				return false;
 			}
 			char next = str[i + 1];
 			if (next != '0' && next != '1') {
-				context.add_error("JSON Pointer has invalid escape sequence", "format", str);
+				context.report_error("format", str, "JSON Pointer has invalid escape sequence");
 				return false;
 			}
 			i++; // Skip next character
@@ -519,7 +522,7 @@ bool FormatRule::validate_base64(const String &str, ValidationContext &context)
 
 	// Check length is multiple of 4
 	if (str.length() % 4 != 0) {
-		context.add_error("Base64 string length must be multiple of 4", "format", str);
+		context.report_error("format", str, "Base64 string length must be multiple of 4");
 		return false;
 	}
 
@@ -540,8 +543,17 @@ bool FormatRule::validate_regex_format(const String &str, ValidationContext &con
 	// Try to create a RegEx to validate the pattern
 	Ref<RegEx> test_regex = RegEx::create_from_string(str);
 	if (!test_regex.is_valid()) {
-		context.add_error(vformat("Invalid regular expression: \"%s\"", str), "format", str);
+		context.report_error("format", str, "Invalid regular expression: \"%s\"", str);
 		return false;
 	}
 	return true;
 }
+
+bool FormatRule::matches(const String &str, ValidationContext &scratch) const {
+	return validate_string(str, scratch);
+}
+
+bool FormatRule::narrow_string_constraints(StringConstraints &constraints) const {
+	constraints.formats.push_back(this);
+	return true;
+}
@@ -22,7 +22,26 @@ public:
 			format(value) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
+
+	/**
+	 * @brief Validates a string against the format
+	 * @param str The string
+	 * @param context Validation context for error tracking
+	 * @return True if the string follows the format or the format is unknown
+	 */
+	bool validate_string(const String &str, ValidationContext &context) const;
+
+	/**
+	 * @brief Checks a string against the format without reporting errors
+	 * @param str The string
+	 * @param scratch Context that does not collect errors, reused across calls
+	 * @return True if the string follows the format or the format is unknown
+	 */
+	bool matches(const String &str, ValidationContext &scratch) const;
+
 	String get_rule_type() const override { return "format"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_STRING; }
 	String get_description() const override;
 
 private:
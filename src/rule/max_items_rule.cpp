@@ -1,4 +1,5 @@
 #include "max_items_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../util.hpp"
 
 using namespace godot;
@@ -10,9 +11,13 @@ bool MaxItemsRule::validate(const Variant &target, ValidationContext &context) c
 	}
 
 	if (actual_size > max_items) {
-		context.add_error(vformat("Array has %d items but maximum is %d", actual_size, max_items), "maxItems", target);
+		context.report_error("maxItems", target, "Array has %d items but maximum is %d", actual_size, max_items);
 		return false;
 	}
 
 	return true;
 }
+
+void MaxItemsRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MAX_ITEMS, this, max_items);
+}
@@ -19,8 +19,10 @@ public:
 			max_items(max) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 
 	String get_rule_type() const override { return "maxItems"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override { return vformat("maxItems(%d)", max_items); }
 };
 
@@ -1,5 +1,9 @@
 #include "max_length_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
+#include "string_constraints.hpp"
+
+#include <algorithm>
 
 using namespace godot;
 
@@ -9,13 +13,21 @@ bool MaxLengthRule::validate(const Variant &target, ValidationContext &context)
 		return true; // Rule doesn't apply to non-strings
 	}
 
-	String str = target.operator String();
-	int64_t actual_length = str.utf8().length(); // Use UTF-8 byte length for proper Unicode handling
+	int64_t actual_length = SchemaUtil::utf8_length(target.operator String()); // Use UTF-8 byte length for proper Unicode handling
 
 	if (actual_length > max_length) {
-		context.add_error(vformat("String length %d exceeds maximum %d", actual_length, max_length), "maxLength", target);
+		context.report_error("maxLength", target, "String length %d exceeds maximum %d", actual_length, max_length);
 		return false;
 	}
 
 	return true;
 }
+
+void MaxLengthRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MAX_LENGTH, this, max_length);
+}
+
+bool MaxLengthRule::narrow_string_constraints(StringConstraints &constraints) const {
+	constraints.max_length = std::min(constraints.max_length, max_length);
+	return true;
+}
@@ -1,4 +1,5 @@
 #include "max_properties_rule.hpp"
+#include "../program/rule_program.hpp"
 
 using namespace godot;
 
@@ -11,9 +12,13 @@ bool MaxPropertiesRule::validate(const Variant &target, ValidationContext &conte
 	int64_t actual_count = dict.size();
 
 	if (actual_count > max_properties) {
-		context.add_error(vformat("Object has %d properties but maximum is %d", actual_count, max_properties), "maxProperties", target);
+		context.report_error("maxProperties", target, "Object has %d properties but maximum is %d", actual_count, max_properties);
 		return false;
 	}
 
 	return true;
 }
+
+void MaxPropertiesRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MAX_PROPERTIES, this, max_properties);
+}
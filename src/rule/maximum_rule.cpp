@@ -1,5 +1,7 @@
 #include "maximum_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
+#include "numeric_range.hpp"
 
 using namespace godot;
 
@@ -17,9 +19,18 @@ bool MaximumRule::validate(const Variant &target, ValidationContext &context) co
 	}
 
 	if (actual_value > maximum) {
-		context.add_error(vformat("Value %f exceeds maximum %f", actual_value, maximum), "maximum", target);
+		context.report_error("maximum", target, "Value %f exceeds maximum %f", actual_value, maximum);
 		return false;
 	}
 
 	return true;
 }
+
+void MaximumRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MAXIMUM, this, 0, maximum);
+}
+
+bool MaximumRule::narrow_numeric_range(NumericRange &range) const {
+	range.maximum = std::min(range.maximum, maximum);
+	return true;
+}
@@ -1,4 +1,5 @@
 #include "min_items_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../util.hpp"
 
 using namespace godot;
@@ -10,9 +11,13 @@ bool MinItemsRule::validate(const Variant &target, ValidationContext &context) c
 	}
 
 	if (actual_size < min_items) {
-		context.add_error(vformat("Array has %d items but minimum is %d", actual_size, min_items), "minItems", target);
+		context.report_error("minItems", target, "Array has %d items but minimum is %d", actual_size, min_items);
 		return false;
 	}
 
 	return true;
 }
+
+void MinItemsRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MIN_ITEMS, this, min_items);
+}
@@ -19,8 +19,10 @@ public:
 			min_items(min) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 
 	String get_rule_type() const override { return "minItems"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override { return vformat("minItems(%d)", min_items); }
 };
 
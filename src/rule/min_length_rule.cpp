@@ -1,5 +1,9 @@
 #include "min_length_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
+#include "string_constraints.hpp"
+
+#include <algorithm>
 
 using namespace godot;
 
@@ -9,13 +13,21 @@ bool MinLengthRule::validate(const Variant &target, ValidationContext &context)
 		return true; // Rule doesn't apply to non-strings
 	}
 
-	String str = target.operator String();
-	int64_t actual_length = str.utf8().length(); // Use UTF-8 byte length for proper Unicode handling
+	int64_t actual_length = SchemaUtil::utf8_length(target.operator String()); // Use UTF-8 byte length for proper Unicode handling
 
 	if (actual_length < min_length) {
-		context.add_error(vformat("String length %d is less than minimum %d", actual_length, min_length), "minLength", target);
+		context.report_error("minLength", target, "String length %d is less than minimum %d", actual_length, min_length);
 		return false;
 	}
 
 	return true;
 }
+
+void MinLengthRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MIN_LENGTH, this, min_length);
+}
+
+bool MinLengthRule::narrow_string_constraints(StringConstraints &constraints) const {
+	constraints.min_length = std::max(constraints.min_length, min_length);
+	return true;
+}
@@ -22,7 +22,10 @@ public:
 			min_length(min) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
 	String get_rule_type() const override { return "minLength"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_STRING; }
 	String get_description() const override { return vformat("minLength(%d)", min_length); }
 };
 
@@ -1,4 +1,5 @@
 #include "min_properties_rule.hpp"
+#include "../program/rule_program.hpp"
 
 using namespace godot;
 
@@ -11,9 +12,13 @@ bool MinPropertiesRule::validate(const Variant &target, ValidationContext &conte
 	int64_t actual_count = dict.size();
 
 	if (actual_count < min_properties) {
-		context.add_error(vformat("Object has %d properties but minimum is %d", actual_count, min_properties), "minProperties", target);
+		context.report_error("minProperties", target, "Object has %d properties but minimum is %d", actual_count, min_properties);
 		return false;
 	}
 
 	return true;
 }
+
+void MinPropertiesRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MIN_PROPERTIES, this, min_properties);
+}
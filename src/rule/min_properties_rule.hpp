@@ -19,7 +19,9 @@ public:
 			min_properties(min) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "minProperties"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_OBJECT; }
 	String get_description() const override { return vformat("minProperties(%d)", min_properties); }
 };
 
@@ -1,5 +1,7 @@
 #include "minimum_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
+#include "numeric_range.hpp"
 
 using namespace godot;
 
@@ -17,9 +19,18 @@ bool MinimumRule::validate(const Variant &target, ValidationContext &context) co
 	}
 
 	if (actual_value < minimum) {
-		context.add_error(vformat("Value %f is less than minimum %f", actual_value, minimum), "minimum", target);
+		context.report_error("minimum", target, "Value %f is less than minimum %f", actual_value, minimum);
 		return false;
 	}
 
 	return true;
 }
+
+void MinimumRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_MINIMUM, this, 0, minimum);
+}
+
+bool MinimumRule::narrow_numeric_range(NumericRange &range) const {
+	range.minimum = std::max(range.minimum, minimum);
+	return true;
+}
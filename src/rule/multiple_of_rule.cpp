@@ -1,4 +1,5 @@
 #include "multiple_of_rule.hpp"
+#include "numeric_range.hpp"
 
 using namespace godot;
 
@@ -8,7 +9,7 @@ bool MultipleOfRule::validate(const Variant &target, ValidationContext &context)
 	}
 
 	if (multiple_of <= 0) {
-		context.add_error("multipleOf must be greater than 0", "multipleOf");
+		context.report_error("multipleOf", Variant(), "multipleOf must be greater than 0");
 		return false;
 	}
 
@@ -24,9 +25,18 @@ bool MultipleOfRule::validate(const Variant &target, ValidationContext &context)
 
 	// Check if the remainder is close to zero (accounting for floating point precision)
 	if (abs(remainder) > 1e-10 && abs(remainder - multiple_of) > 1e-10) {
-		context.add_error(vformat("Value %f is not a multiple of %f", actual_value, multiple_of), "multipleOf", target);
+		context.report_error("multipleOf", target, "Value %f is not a multiple of %f", actual_value, multiple_of);
 		return false;
 	}
 
 	return true;
 }
+
+bool MultipleOfRule::narrow_numeric_range(NumericRange &range) const {
+	// An invalid multipleOf or a second one is left to validate()
+	if (multiple_of <= 0 || range.multiple_of != 0.0) {
+		return false;
+	}
+	range.multiple_of = multiple_of;
+	return true;
+}
@@ -18,8 +18,10 @@ public:
 			multiple_of(multiplier) {}
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	bool narrow_numeric_range(NumericRange &range) const override;
 
 	String get_rule_type() const override { return "multipleOf"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_NUMERIC; }
 	String get_description() const override { return vformat("multipleOf(%f)", multiple_of); }
 };
 
@@ -1,4 +1,5 @@
 #include "not_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
 
 using namespace godot;
@@ -8,19 +9,22 @@ NotRule::NotRule(std::shared_ptr<ValidationRule> rule) :
 
 bool NotRule::validate(const Variant &target, ValidationContext &context) const {
 	if (!sub_rule) {
-		context.add_error("NotRule has no sub-rule to negate", "not");
+		context.report_error("not", Variant(), "NotRule has no sub-rule to negate");
 		return false;
 	}
 
-	// Create a temporary context to capture sub-rule errors
-	// We don't want to propagate these errors to the main context
-	ValidationContext temp_context = context.create_child_schema("not");
-
-	bool sub_rule_passed = sub_rule->validate(target, temp_context);
+	// Sub-rule errors are discarded, we don't want to propagate them
+	const size_t error_mark = context.error_count();
+	bool sub_rule_passed;
+	{
+		ValidationContext::SchemaScope scope(context, "not");
+		sub_rule_passed = sub_rule->validate(target, context);
+	}
+	context.truncate_errors(error_mark);
 
 	if (sub_rule_passed) {
 		// Sub-rule passed, but we need it to fail for NOT to succeed
-		context.add_error(vformat("Value matched the negated schema when it should not have: %s", sub_rule->get_description()), "not");
+		report_match(context);
 		return false;
 	}
 
@@ -28,6 +32,26 @@ bool NotRule::validate(const Variant &target, ValidationContext &context) const
 	return true;
 }
 
+void NotRule::report_match(ValidationContext &context) const {
+	if (context.is_collecting_errors()) {
+		context.report_error("not", Variant(), "Value matched the negated schema when it should not have: %s", sub_rule->get_description());
+	}
+}
+
+void NotRule::lower(RuleProgramBuilder &builder) const {
+	// The missing sub-rule case only reports an error
+	if (!sub_rule) {
+		builder.emit_call(this);
+		return;
+	}
+
+	builder.begin_combinator(COMBINATOR_NOT, this);
+	builder.begin_branch("not");
+	sub_rule->lower(builder);
+	builder.end_branch();
+	builder.end_combinator();
+}
+
 String NotRule::get_description() const {
 	if (!sub_rule) {
 		return "not(null)";
@@ -22,7 +22,14 @@ private:
 public:
 	explicit NotRule(std::shared_ptr<ValidationRule> rule);
 
+	/**
+	 * @brief Reports that the value matched the negated sub-rule
+	 * @param context Validation context receiving the error
+	 */
+	void report_match(ValidationContext &context) const;
+
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "not"; }
 	String get_description() const override;
 };
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "../util.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace godot {
+
+/**
+ * @struct NumericRange
+ * @brief Numeric constraints of a schema, checked directly on packed array buffers
+ *
+ * Built by ValidationRule::narrow_numeric_range() for item schemas that only
+ * constrain numbers. find_rejected() scans raw values without boxing them into
+ * Variants. It may reject values the rules would accept, but never accepts a
+ * value the rules reject, so rejected values are re-checked by the rules,
+ * which also report the exact error.
+ */
+struct NumericRange {
+	/**
+	 * @brief Number of values reduced before the scan checks for a rejection
+	 */
+	static constexpr int64_t SCAN_BLOCK_SIZE = 256;
+
+	uint32_t type_flags = SchemaUtil::JSON_TYPE_ANY; // Accepted SchemaUtil::JsonTypeFlags
+	double minimum = -std::numeric_limits<double>::infinity();
+	double maximum = std::numeric_limits<double>::infinity();
+	double exclusive_minimum = -std::numeric_limits<double>::infinity();
+	double exclusive_maximum = std::numeric_limits<double>::infinity();
+	double multiple_of = 0.0; // 0 if not constrained
+
+	/**
+	 * @brief Checks if a value is inside the bounds
+	 * @param value The value
+	 * @return False for values outside the bounds and NaN
+	 */
+	bool is_in_bounds(double value) const {
+		// Bitwise and keeps the expression branch-free for vectorization
+		return (value >= minimum) & (value <= maximum) & (value > exclusive_minimum) & (value < exclusive_maximum);
+	}
+
+	/**
+	 * @brief Checks if a value has the JSON type of an integer
+	 * @param value The value
+	 * @return True for integral values within the int64 range, as in SchemaUtil::get_variant_json_type_flag()
+	 */
+	static bool is_integral(double value) {
+		return (value == std::trunc(value)) & (std::fabs(value) < 9.2233720368547758e18);
+	}
+
+	/**
+	 * @brief Checks if a value passes all constraints
+	 * @param value The value
+	 * @return True if the value is accepted
+	 */
+	template <typename T>
+	bool accepts(T value) const {
+		const double number = static_cast<double>(value);
+		if (!is_in_bounds(number)) {
+			return false;
+		}
+
+		if constexpr (std::is_integral_v<T>) {
+			if (!(type_flags & SchemaUtil::JSON_TYPE_INTEGER)) {
+				return false;
+			}
+			if (multiple_of > 0.0 && multiple_of == std::trunc(multiple_of) && multiple_of <= 9007199254740992.0 &&
+					value >= -9007199254740992 && value <= 9007199254740992) {
+				// Exact in double precision, same outcome as the fmod() check
+				return value % static_cast<int64_t>(multiple_of) == 0;
+			}
+		} else {
+			if (!(type_flags & (is_integral(number) ? SchemaUtil::JSON_TYPE_INTEGER : SchemaUtil::JSON_TYPE_NUMBER))) {
+				return false;
+			}
+		}
+
+		if (multiple_of > 0.0) {
+			// Same tolerance as MultipleOfRule
+			const double remainder = std::fmod(number, multiple_of);
+			return std::fabs(remainder) <= 1e-10 || std::fabs(remainder - multiple_of) <= 1e-10;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Finds the first rejected value in [begin, end)
+	 * @param values The value buffer
+	 * @param begin First index to check
+	 * @param end One past the last index to check
+	 * @return Index of the first rejected value, or end if all are accepted
+	 */
+	template <typename T>
+	int64_t find_rejected(const T *values, int64_t begin, int64_t end) const {
+		// Without per-value type or multipleOf checks, a block that is inside the bounds passes as a whole
+		const bool bounds_only = multiple_of == 0.0 &&
+				(type_flags & SchemaUtil::JSON_TYPE_NUMERIC) == SchemaUtil::JSON_TYPE_NUMERIC;
+
+		for (int64_t block = begin; block < end; block += SCAN_BLOCK_SIZE) {
+			const int64_t block_end = std::min(block + SCAN_BLOCK_SIZE, end);
+
+			if (bounds_only) {
+				bool in_bounds = true;
+				for (int64_t i = block; i < block_end; i++) {
+					in_bounds &= is_in_bounds(static_cast<double>(values[i]));
+				}
+				if (in_bounds) {
+					continue;
+				}
+			}
+
+			for (int64_t i = block; i < block_end; i++) {
+				if (!accepts(values[i])) {
+					return i;
+				}
+			}
+		}
+		return end;
+	}
+};
+
+} // namespace godot
@@ -0,0 +1,197 @@
+#include "object_rule.hpp"
+#include "../program/rule_program.hpp"
+#include "../validation_context.hpp"
+
+#include <godot_cpp/classes/reg_ex_match.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+using namespace godot;
+
+void ObjectRule::add_property(const String &name, std::shared_ptr<ValidationRule> rule) {
+	PropertyEntry &entry = properties[name];
+	entry.segment = PathSegment(name);
+	entry.rule = rule;
+}
+
+void ObjectRule::add_pattern_property(const String &pattern, std::shared_ptr<ValidationRule> rule) {
+	PatternEntry entry;
+	entry.pattern = pattern;
+	entry.rule = rule;
+
+	// Compile once here instead of once per validated key
+	Ref<RegEx> regex = RegEx::create_from_string(pattern);
+	if (regex.is_valid() && regex->is_valid()) {
+		entry.regex = regex;
+	} else {
+		UtilityFunctions::push_warning(vformat("ObjectRule: invalid regex pattern '%s'", pattern));
+	}
+
+	pattern_properties.push_back(entry);
+}
+
+template <typename Visitor>
+bool ObjectRule::visit_property_checks(const String &key, Visitor &&visitor) const {
+	PropertyCheck check;
+
+	if (property_names_rule) {
+		check.rule = property_names_rule.get();
+		check.segment = PathSegment("propertyName:", key);
+		check.validates_key = true;
+		if (!visitor(check)) {
+			return false;
+		}
+		check.validates_key = false;
+	}
+
+	// Declared properties
+	bool covered = false;
+	const auto property = properties.find(key);
+	if (property != properties.end()) {
+		covered = true;
+		if (property->second.rule) {
+			check.rule = property->second.rule.get();
+			check.segment = property->second.segment;
+			if (!visitor(check)) {
+				return false;
+			}
+		}
+	}
+
+	// Pattern properties, every matching pattern applies
+	for (const PatternEntry &entry : pattern_properties) {
+		if (entry.regex.is_null() || entry.regex->search(key).is_null()) {
+			continue;
+		}
+
+		covered = true;
+		if (entry.rule) {
+			check.rule = entry.rule.get();
+			check.segment = PathSegment(key);
+			if (!visitor(check)) {
+				return false;
+			}
+		}
+	}
+
+	if (covered) {
+		return true;
+	}
+
+	// Additional properties
+	if (!additional_properties_allowed) {
+		check.rule = nullptr;
+		check.segment = PathSegment(key);
+		return visitor(check);
+	} else if (additional_properties_rule) {
+		check.rule = additional_properties_rule.get();
+		check.segment = PathSegment(key);
+		return visitor(check);
+	}
+
+	return true;
+}
+
+void ObjectRule::plan_property(const String &key, std::vector<PropertyCheck> &out_checks) const {
+	visit_property_checks(key, [&out_checks](const PropertyCheck &check) {
+		out_checks.push_back(check);
+		return true;
+	});
+}
+
+void ObjectRule::report_additional_property(const String &key, const Variant &value, ValidationContext &context) const {
+	context.report_error("additionalProperties", value, "Additional property \"%s\" is not allowed", key);
+}
+
+bool ObjectRule::validate(const Variant &target, ValidationContext &context) const {
+	if (target.get_type() != Variant::DICTIONARY) {
+		return true; // Rule doesn't apply to non-objects
+	}
+
+	const Dictionary dict = target.operator Dictionary();
+	const Array keys = dict.keys();
+	const Array values = dict.values();
+	bool all_valid = true;
+
+	for (int64_t i = 0; i < keys.size(); i++) {
+		const Variant &key = keys[i];
+		const Variant &value = values[i];
+		const String key_str = key;
+
+		const bool completed = visit_property_checks(key_str, [&](const PropertyCheck &check) {
+			{
+				ValidationContext::InstanceScope scope(context, check.segment);
+				if (!check.rule) {
+					report_additional_property(key_str, value, context);
+				} else if (check.rule->validate(check.validates_key ? key : value, context)) {
+					return true;
+				}
+			}
+
+			// Checked once the property's subtree is left, its own error budget does not stop its siblings
+			all_valid = false;
+			return !context.should_stop_on_failure();
+		});
+
+		if (!completed) {
+			return false;
+		}
+	}
+
+	return all_valid;
+}
+
+void ObjectRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_properties(this);
+
+	// Subschemas run as subroutines of the property loop
+	if (property_names_rule) {
+		builder.add_subroutine(property_names_rule.get());
+	}
+	for (const auto &[name, entry] : properties) {
+		if (entry.rule) {
+			builder.add_subroutine(entry.rule.get());
+		}
+	}
+	for (const PatternEntry &entry : pattern_properties) {
+		if (entry.rule) {
+			builder.add_subroutine(entry.rule.get());
+		}
+	}
+	if (additional_properties_rule) {
+		builder.add_subroutine(additional_properties_rule.get());
+	}
+}
+
+bool ObjectRule::is_empty() const {
+	if (property_names_rule || additional_properties_rule || !additional_properties_allowed) {
+		return false;
+	}
+
+	for (const auto &[name, entry] : properties) {
+		if (entry.rule) {
+			return false;
+		}
+	}
+
+	for (const PatternEntry &entry : pattern_properties) {
+		if (entry.rule) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+String ObjectRule::get_description() const {
+	String desc = vformat("object(%d properties, %d patterns", static_cast<int64_t>(properties.size()), static_cast<int64_t>(pattern_properties.size()));
+	if (property_names_rule) {
+		desc += ", propertyNames";
+	}
+	if (!additional_properties_allowed) {
+		desc += ", no additional";
+	} else if (additional_properties_rule) {
+		desc += ", additional";
+	}
+	desc += ")";
+	return desc;
+}
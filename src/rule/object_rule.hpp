@@ -0,0 +1,122 @@
+#pragma once
+
+#include "../hashers.hpp"
+#include "../path_segment.hpp"
+#include "validation_rule.hpp"
+
+#include <godot_cpp/classes/reg_ex.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace godot {
+
+// Forward declarations
+class ValidationContext;
+
+/**
+ * @class ObjectRule
+ * @brief Validates properties, patternProperties, additionalProperties and propertyNames in a single pass
+ *
+ * Each key of the instance is visited once and classified against a hash table
+ * of declared property names and the precompiled patterns, then validated
+ * against every subschema that applies to it.
+ */
+class ObjectRule : public ValidationRule {
+public:
+	/**
+	 * @struct PropertyCheck
+	 * @brief A subschema that applies to one property of the instance
+	 */
+	struct PropertyCheck {
+		const ValidationRule *rule = nullptr; // Null for a property disallowed by "additionalProperties": false
+		PathSegment segment;
+		bool validates_key = false; // "propertyNames" validate the key instead of the value
+	};
+
+private:
+	struct PropertyEntry {
+		PathSegment segment;
+		std::shared_ptr<ValidationRule> rule; // Null when the property schema has no constraints
+	};
+
+	struct PatternEntry {
+		String pattern;
+		Ref<RegEx> regex; // Null when the pattern failed to compile
+		std::shared_ptr<ValidationRule> rule;
+	};
+
+	std::unordered_map<String, PropertyEntry> properties;
+	std::vector<PatternEntry> pattern_properties;
+	std::shared_ptr<ValidationRule> property_names_rule;
+	std::shared_ptr<ValidationRule> additional_properties_rule;
+	bool additional_properties_allowed = true;
+
+	/**
+	 * @brief Calls a visitor for each check that applies to a property, in validation order
+	 * @param key The property key
+	 * @param visitor Called with each PropertyCheck, returns false to stop
+	 * @return False if the visitor stopped
+	 */
+	template <typename Visitor>
+	bool visit_property_checks(const String &key, Visitor &&visitor) const;
+
+public:
+	/**
+	 * @brief Declares a property from "properties"
+	 * @param name The property name
+	 * @param rule Rules for the property value, may be null if unconstrained
+	 */
+	void add_property(const String &name, std::shared_ptr<ValidationRule> rule);
+
+	/**
+	 * @brief Declares a pattern from "patternProperties"
+	 * @param pattern The regex pattern
+	 * @param rule Rules for matching property values, may be null if unconstrained
+	 */
+	void add_pattern_property(const String &pattern, std::shared_ptr<ValidationRule> rule);
+
+	/**
+	 * @brief Sets the "propertyNames" rules applied to every key
+	 * @param rule Rules for the keys
+	 */
+	void set_property_names_rule(std::shared_ptr<ValidationRule> rule) { property_names_rule = rule; }
+
+	/**
+	 * @brief Sets the "additionalProperties" rules
+	 * @param rule Rules for properties neither declared nor matched by a pattern
+	 */
+	void set_additional_properties_rule(std::shared_ptr<ValidationRule> rule) { additional_properties_rule = rule; }
+
+	/**
+	 * @brief Sets whether properties neither declared nor matched by a pattern are allowed
+	 * @param allowed False for "additionalProperties": false
+	 */
+	void set_additional_properties_allowed(bool allowed) { additional_properties_allowed = allowed; }
+
+	/**
+	 * @brief Collects the checks that apply to a property, in validation order
+	 * @param key The property key
+	 * @param out_checks Receives the checks
+	 */
+	void plan_property(const String &key, std::vector<PropertyCheck> &out_checks) const;
+
+	/**
+	 * @brief Reports a property disallowed by "additionalProperties": false
+	 * @param key The property key
+	 * @param value The property value
+	 * @param context Validation context, positioned at the property
+	 */
+	void report_additional_property(const String &key, const Variant &value, ValidationContext &context) const;
+
+	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
+	bool is_empty() const override;
+	String get_rule_type() const override { return "object"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_OBJECT; }
+	String get_description() const override;
+};
+
+} // namespace godot
@@ -1,65 +1,104 @@
 #include "one_of_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
 
 using namespace godot;
 
 void OneOfRule::add_sub_rule(std::shared_ptr<ValidationRule> rule) {
 	if (rule) {
+		sub_rule_segments.push_back(vformat("oneOf/%d", static_cast<int64_t>(sub_rules.size())));
 		sub_rules.push_back(rule);
 	}
 }
 
 bool OneOfRule::validate(const Variant &target, ValidationContext &context) const {
 	if (sub_rules.empty()) {
-		context.add_error("oneOf requires at least one sub-schema", "oneOf");
+		context.report_error("oneOf", Variant(), "oneOf requires at least one sub-schema");
 		return false;
 	}
 
 	// Exactly one sub-rule must pass
 	int64_t passed_count = 0;
 	std::vector<size_t> passed_indices;
-	std::vector<ValidationContext> failed_contexts;
+	const size_t error_mark = context.error_count();
+	size_t first_failure_end = error_mark;
+	bool has_failure = false;
 
 	for (int64_t i = 0; i < sub_rules.size(); i++) {
-		ValidationContext sub_context = context.create_child_schema(vformat("oneOf/%d", i));
+		bool passed;
+		{
+			ValidationContext::SchemaScope scope(context, sub_rule_segments[i]);
+			passed = sub_rules[i]->validate(target, context);
+		}
 
-		if (sub_rules[i]->validate(target, sub_context)) {
+		if (passed) {
 			passed_count++;
 			passed_indices.push_back(i);
 
+			// Without collected errors a second match already decides the outcome
+			if (passed_count > 1 && context.should_stop_on_failure()) {
+				return false;
+			}
+
 			// Continue checking all schemas to count total passes
-		} else {
-			failed_contexts.push_back(sub_context);
+		} else if (!has_failure) {
+			// Keep errors from the first failed schema for debugging
+			has_failure = true;
+			first_failure_end = context.error_count();
+			continue;
 		}
+
+		context.truncate_errors(first_failure_end);
 	}
 
 	if (passed_count == 0) {
-		context.add_error(vformat("Value failed all %d oneOf schemas", static_cast<int64_t>(sub_rules.size())), "oneOf");
-
-		// Show errors from first failed schema for debugging
-		if (!failed_contexts.empty()) {
-			context.merge_errors(failed_contexts[0]);
-		}
-
+		report_no_match(error_mark, context);
 		return false;
 
 	} else if (passed_count > 1) {
-		String passed_list;
-		for (size_t i = 0; i < passed_indices.size(); i++) {
-			if (i > 0) {
-				passed_list += ", ";
-			}
-			passed_list += String::num(passed_indices[i]);
-		}
-
-		context.add_error(vformat("Value matched %d oneOf schemas (indices: %s) but exactly 1 is required", passed_count, passed_list), "oneOf");
+		context.truncate_errors(error_mark);
+		report_multiple_matches(passed_indices, context);
 		return false;
 	}
 
 	// Exactly one passed - success!
+	context.truncate_errors(error_mark);
 	return true;
 }
 
+void OneOfRule::report_no_match(size_t error_mark, ValidationContext &context) const {
+	context.report_error_at(error_mark, "oneOf", Variant(), "Value failed all %d oneOf schemas", static_cast<int64_t>(sub_rules.size()));
+}
+
+void OneOfRule::report_multiple_matches(const std::vector<size_t> &passed_indices, ValidationContext &context) const {
+	if (!context.is_collecting_errors()) {
+		return;
+	}
+
+	Array passed_list;
+	for (size_t index : passed_indices) {
+		passed_list.push_back(static_cast<int64_t>(index));
+	}
+
+	context.report_error("oneOf", Variant(), "Value matched %d oneOf schemas (indices: %s) but exactly 1 is required", static_cast<int64_t>(passed_indices.size()), ValidationError::MessageList{ passed_list });
+}
+
+void OneOfRule::lower(RuleProgramBuilder &builder) const {
+	// The empty case only reports an error
+	if (sub_rules.empty()) {
+		builder.emit_call(this);
+		return;
+	}
+
+	builder.begin_combinator(COMBINATOR_ONE_OF, this);
+	for (size_t i = 0; i < sub_rules.size(); i++) {
+		builder.begin_branch(sub_rule_segments[i]);
+		sub_rules[i]->lower(builder);
+		builder.end_branch();
+	}
+	builder.end_combinator();
+}
+
 String OneOfRule::get_description() const {
 	if (sub_rules.empty()) {
 		return "oneOf(empty)";
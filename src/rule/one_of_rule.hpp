@@ -19,11 +19,27 @@ class ValidationContext;
 class OneOfRule : public ValidationRule {
 private:
 	std::vector<std::shared_ptr<ValidationRule>> sub_rules;
+	std::vector<String> sub_rule_segments; // Precomputed "oneOf/<index>" Schema path segments
 
 public:
 	void add_sub_rule(std::shared_ptr<ValidationRule> rule);
 
+	/**
+	 * @brief Reports the summary error after every sub-rule failed
+	 * @param error_mark Error count before the first sub-rule ran, the summary is inserted there
+	 * @param context Validation context receiving the error
+	 */
+	void report_no_match(size_t error_mark, ValidationContext &context) const;
+
+	/**
+	 * @brief Reports that more than one sub-rule passed
+	 * @param passed_indices Indices of the passing sub-rules
+	 * @param context Validation context receiving the error
+	 */
+	void report_multiple_matches(const std::vector<size_t> &passed_indices, ValidationContext &context) const;
+
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "oneOf"; }
 	String get_description() const override;
 };
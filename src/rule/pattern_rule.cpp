@@ -1,5 +1,6 @@
 #include "pattern_rule.hpp"
 #include "../validation_context.hpp"
+#include "string_constraints.hpp"
 
 #include <godot_cpp/classes/reg_ex_match.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -23,7 +24,7 @@ bool PatternRule::validate(const Variant &target, ValidationContext &context) co
 
 	// Check if regex is valid
 	if (!pattern_regex.is_valid()) {
-		context.add_error(vformat("Invalid regex pattern '%s'", pattern_string), "pattern");
+		context.report_error("pattern", Variant(), "Invalid regex pattern '%s'", pattern_string);
 		return false;
 	}
 
@@ -31,9 +32,18 @@ bool PatternRule::validate(const Variant &target, ValidationContext &context) co
 	Ref<RegExMatch> match = pattern_regex->search(str);
 
 	if (!match.is_valid()) {
-		context.add_error(vformat("String '%s' does not match pattern '%s'", str, pattern_string), "pattern", target);
+		context.report_error("pattern", target, "String '%s' does not match pattern '%s'", str, pattern_string);
 		return false;
 	}
 
 	return true;
 }
+
+bool PatternRule::matches(const String &str) const {
+	return pattern_regex.is_valid() && pattern_regex->search(str).is_valid();
+}
+
+bool PatternRule::narrow_string_constraints(StringConstraints &constraints) const {
+	constraints.patterns.push_back(this);
+	return true;
+}
@@ -23,7 +23,17 @@ public:
 	explicit PatternRule(const String &pattern);
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
+
+	/**
+	 * @brief Checks a string against the pattern without reporting errors
+	 * @param str The string
+	 * @return True if the pattern matches, false if it does not or failed to compile
+	 */
+	bool matches(const String &str) const;
+
 	String get_rule_type() const override { return "pattern"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_STRING; }
 	String get_description() const override { return vformat("pattern(/%s/)", pattern_string); }
 };
 
@@ -1,4 +1,5 @@
 #include "ref_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../rule_factory.hpp"
 #include "../schema_registry.hpp"
 #include "../validation_context.hpp"
@@ -7,78 +8,110 @@
 
 using namespace godot;
 
-// Simple thread-local depth counter to prevent infinite recursion
-thread_local int validation_depth = 0;
-const int MAX_VALIDATION_DEPTH = 50; // Reasonable limit
-
 RefRule::RefRule(const String &ref_uri, const Schema *schema) :
-		reference_uri(ref_uri), source_schema(schema), resolution_attempted(false) {}
+		reference_uri(ref_uri), schema_path_segment(vformat("$ref:%s", ref_uri)), source_schema(schema) {}
 
-bool RefRule::validate(const Variant &target, ValidationContext &context) const {
-	// Simple depth-based recursion protection
-	if (validation_depth >= MAX_VALIDATION_DEPTH) {
-		return true; // Assume valid to break potential infinite recursion
+RefRule::LinkStatus RefRule::link() const {
+	if (is_linked()) {
+		return LINK_OK;
 	}
 
-	// Lazy resolution
-	if (!resolution_attempted) {
-		cached_schema = source_schema->resolve_reference(reference_uri);
-		resolution_attempted = true;
-
-		if (!cached_schema.is_valid()) {
-			context.add_error(vformat("Could not resolve reference: %s", reference_uri), "ref", reference_uri);
-			return false;
-		}
+	// Resolve and compile outside the lock, compiling may link other references
+	Ref<Schema> schema = source_schema->resolve_reference(reference_uri);
+	if (schema.is_null()) {
+		return LINK_UNRESOLVED;
 	}
 
-	if (!cached_schema.is_valid()) {
-		return false;
+	const Schema::CompiledState *state = schema->ensure_compiled();
+	if (!state || !state->rules) {
+		return LINK_NOT_COMPILED;
 	}
 
-	// Increment depth counter
-	validation_depth++;
+	// A target in the same document lives as long as the rules referring to it.
+	// Holding it would keep the document alive through its own compiled rules.
+	const bool external = schema->get_root().ptr() != source_schema->get_root().ptr();
 
-	bool validation_result = false;
+	std::lock_guard<std::mutex> lock(link_mutex);
+	if (!target_rules.load(std::memory_order_relaxed)) {
+		if (external) {
+			target_schema = schema;
+		}
+		target_rules.store(state->rules.get(), std::memory_order_release);
+	}
+	return LINK_OK;
+}
 
-	try {
-		// Ensure the schema is compiled
-		cached_schema->compilation_mutex->lock();
-		bool needs_compilation = !cached_schema->is_compiled;
-		cached_schema->compilation_mutex->unlock();
+void RefRule::report_depth_exceeded(const Variant &target, ValidationContext &context) const {
+	context.report_error("maxDepth", target, "Reference '%s' exceeds the maximum validation depth of %d", reference_uri, context.get_max_depth());
+}
 
-		if (needs_compilation) {
-			cached_schema->compile();
+bool RefRule::validate(const Variant &target, ValidationContext &context) const {
+	const RuleGroup *rules = target_rules.load(std::memory_order_acquire);
+	if (!rules) {
+		// Not linked at compile time, e.g. the target was registered afterwards
+		switch (link()) {
+			case LINK_UNRESOLVED:
+				context.report_error("ref", reference_uri, "Could not resolve reference: %s", reference_uri);
+				return false;
+			case LINK_NOT_COMPILED:
+				context.report_error("ref", reference_uri, "Referenced schema '%s' is not compiled", reference_uri);
+				return false;
+			default:
+				rules = target_rules.load(std::memory_order_acquire);
+				break;
 		}
+	}
 
-		// Get the compiled rules safely
-		cached_schema->compilation_mutex->lock();
-
-		if (!cached_schema->is_compiled || !cached_schema->rules) {
-			cached_schema->compilation_mutex->unlock();
-			context.add_error(vformat("Referenced schema '%s' is not compiled", reference_uri), "ref", reference_uri);
-			validation_result = false;
-		} else {
-			// Copy rules reference so we can unlock
-			auto rules_to_validate = cached_schema->rules;
-			cached_schema->compilation_mutex->unlock();
+	// Shared and cyclic containers are validated once per target
+	const uintptr_t container_id = context.is_memoizing() ? SchemaUtil::get_container_id(target) : 0;
+	if (container_id) {
+		switch (context.lookup_memo(rules, container_id)) {
+			case ValidationContext::MEMO_VALID:
+			case ValidationContext::MEMO_IN_PROGRESS:
+				return true;
+			case ValidationContext::MEMO_INVALID:
+				if (context.should_stop_on_failure()) {
+					return false;
+				}
+				break; // Validate again to report the errors at this path
+			default:
+				break;
+		}
+	}
 
-			// Create child context for the reference validation
-			ValidationContext ref_context = context.create_child_schema(vformat("$ref:%s", reference_uri));
+	// Recursive schemas terminate on the data, this only stops runaway nesting
+	if (!context.enter_reference()) {
+		report_depth_exceeded(target, context);
+		return false;
+	}
 
-			// Validate using the resolved schema's rules
-			validation_result = rules_to_validate->validate(target, ref_context);
+	const size_t memo_token = container_id ? context.begin_memo(rules, container_id) : 0;
+	bool validation_result = false;
 
-			// Merge any errors from the reference validation
-			context.merge_errors(ref_context);
-		}
+	try {
+		// Validate using the resolved schema's rules under the reference path
+		ValidationContext::SchemaScope scope(context, schema_path_segment);
+		validation_result = rules->validate(target, context);
 	} catch (...) {
 		// Ensure we clean up the depth counter even if an exception occurs
-		validation_depth--;
+		context.exit_reference();
 		throw;
 	}
 
-	// Decrement depth counter
-	validation_depth--;
+	if (container_id) {
+		context.end_memo(rules, container_id, memo_token, validation_result);
+	}
+	context.exit_reference();
 
 	return validation_result;
 }
+
+void RefRule::lower(RuleProgramBuilder &builder) const {
+	// Unlinked references resolve at validation time through validate()
+	const RuleGroup *rules = target_rules.load(std::memory_order_acquire);
+	if (rules) {
+		builder.emit_reference(this, rules, schema_path_segment);
+	} else {
+		builder.emit_call(this);
+	}
+}
@@ -4,12 +4,15 @@
 #include "validation_rule.hpp"
 
 #include <godot_cpp/variant/variant.hpp>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 namespace godot {
 
 // Forward declarations
+class RuleGroup;
 class ValidationContext;
 class Schema;
 
@@ -17,15 +20,31 @@ class Schema;
  * @class RefRule
  * @brief Validates by delegating to a referenced schema
  *
- * Handles JSON Schema $ref by resolving the reference and delegating
- * validation to the target schema's rules.
+ * Handles JSON Schema $ref by delegating validation to the target schema's
+ * rules. References are linked by RuleFactory once the compilation that
+ * created them has finished, so cycles back into schemas that were still
+ * compiling resolve to their published rules. Linked references validate
+ * through a direct pointer, references that could not be linked yet (e.g. an
+ * external schema registered later) retry linking when validated.
  */
 class RefRule : public ValidationRule {
+public:
+	/**
+	 * @brief Outcome of linking a reference
+	 */
+	enum LinkStatus {
+		LINK_OK,
+		LINK_UNRESOLVED, // The URI does not resolve to a schema
+		LINK_NOT_COMPILED, // The target schema has no compiled rules
+	};
+
 private:
 	String reference_uri; // The $ref URI
+	String schema_path_segment; // Precomputed "$ref:<uri>" Schema path segment
 	const Schema *source_schema; // Schema containing this $ref
-	mutable Ref<Schema> cached_schema; // Cache the resolved schema
-	mutable bool resolution_attempted;
+	mutable std::atomic<const RuleGroup *> target_rules{ nullptr }; // Linked rules, read without locking
+	mutable Ref<Schema> target_schema; // Keeps the linked rules of another document alive, null within the same document
+	mutable std::mutex link_mutex; // Serializes publishing the link
 
 public:
 	/**
@@ -43,6 +62,36 @@ public:
 	 */
 	bool validate(const Variant &target, ValidationContext &context) const override;
 
+	/**
+	 * @brief Resolves the reference and links the target schema's rules
+	 * @return LINK_OK if the reference is linked
+	 *
+	 * Compiles the target schema if needed. Linking is idempotent and safe to
+	 * call from several threads.
+	 */
+	LinkStatus link() const;
+
+	/**
+	 * @brief Reports that evaluating the reference would exceed the maximum depth
+	 * @param target The value being validated
+	 * @param context Validation context receiving the error
+	 */
+	void report_depth_exceeded(const Variant &target, ValidationContext &context) const;
+
+	void lower(RuleProgramBuilder &builder) const override;
+
+	/**
+	 * @brief Checks if the reference has been linked
+	 * @return True if validation calls the target rules directly
+	 */
+	bool is_linked() const { return target_rules.load(std::memory_order_acquire) != nullptr; }
+
+	/**
+	 * @brief Gets the linked target rules
+	 * @return The target rules, null if not linked
+	 */
+	const RuleGroup *get_target_rules() const { return target_rules.load(std::memory_order_acquire); }
+
 	String get_rule_type() const override { return "ref"; }
 
 	String get_description() const override { return vformat("$ref(%s)", reference_uri); }
@@ -17,8 +17,11 @@ bool RequiredPropertiesRule::validate(const Variant &target, ValidationContext &
 		StringName prop_name = StringName(required_prop);
 
 		if (!dict.has(prop_name)) {
-			context.add_error(vformat("Required property \"%s\" is missing", required_prop), "required");
+			context.report_error("required", Variant(), "Required property \"%s\" is missing", required_prop);
 			all_present = false;
+			if (context.should_stop_on_failure()) {
+				break;
+			}
 		}
 	}
 
@@ -25,6 +25,7 @@ public:
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
 	String get_rule_type() const override { return "required"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_OBJECT; }
 	String get_description() const override;
 };
 
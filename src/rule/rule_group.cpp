@@ -1,21 +1,68 @@
 #include "rule_group.hpp"
+#include "../program/rule_program.hpp"
 #include "../validation_context.hpp"
+#include "numeric_range.hpp"
+#include "string_constraints.hpp"
 
 using namespace godot;
 
 void RuleGroup::add_rule(std::shared_ptr<ValidationRule> rule) {
 	if (rule) {
+		const uint32_t rule_types = rule->get_applicable_types();
+		for (int i = 0; i < SchemaUtil::JSON_TYPE_COUNT; i++) {
+			if (rule_types & (1u << i)) {
+				type_buckets[i].push_back(rule.get());
+			}
+		}
+		applicable_types |= rule_types;
 		rules.push_back(rule);
 	}
 }
 
 bool RuleGroup::validate(const Variant &target, ValidationContext &context) const {
+	// Reuse the result of an unchanged container from the previous run
+	ValidationSnapshot *snapshot = context.get_snapshot();
+	const uintptr_t container_id = snapshot ? SchemaUtil::get_container_id(target) : 0;
+	if (container_id) {
+		if (const ValidationSnapshot::Entry *entry = snapshot->find(this, container_id)) {
+			context.replay_errors(entry->errors, entry->instance_depth, entry->schema_depth);
+			snapshot->replayed(container_id);
+			return entry->valid;
+		}
+		return validate_and_record(target, container_id, *snapshot, context);
+	}
+
+	return validate_rules(target, context);
+}
+
+bool RuleGroup::validate_and_record(const Variant &target, uintptr_t container_id, ValidationSnapshot &snapshot, ValidationContext &context) const {
+	const size_t error_mark = context.error_count();
+	snapshot.begin_record(container_id);
+	const bool valid = validate_rules(target, context);
+
+	ValidationSnapshot::Entry entry;
+	entry.rules = this;
+	entry.valid = valid;
+	entry.instance_depth = context.get_instance_depth();
+	entry.schema_depth = context.get_schema_depth();
+	entry.errors = context.copy_errors_since(error_mark);
+	snapshot.record(target, container_id, std::move(entry));
+	return valid;
+}
+
+bool RuleGroup::validate_rules(const Variant &target, ValidationContext &context) const {
 	bool all_valid = true;
 
+	// Only rules that apply to the target's JSON type can fail
+	const auto &bucket = type_buckets[SchemaUtil::get_json_type_index(SchemaUtil::get_variant_json_type_flag(target))];
+
 	// Validate against all rules and collect all errors
-	for (const auto &rule : rules) {
+	for (const ValidationRule *rule : bucket) {
 		if (!rule->validate(target, context)) {
 			all_valid = false;
+			if (context.should_stop_on_failure()) {
+				break;
+			}
 			// Continue validating other rules to collect all errors
 		}
 	}
@@ -23,6 +70,12 @@ bool RuleGroup::validate(const Variant &target, ValidationContext &context) cons
 	return all_valid;
 }
 
+void RuleGroup::lower(RuleProgramBuilder &builder) const {
+	for (const auto &rule : rules) {
+		rule->lower(builder);
+	}
+}
+
 String RuleGroup::get_description() const {
 	if (rules.empty()) {
 		return "empty_group";
@@ -42,3 +95,29 @@ String RuleGroup::get_description() const {
 	desc += ")";
 	return desc;
 }
+
+bool RuleGroup::narrow_numeric_range(NumericRange &range) const {
+	for (const std::shared_ptr<ValidationRule> &rule : rules) {
+		// Rules that never reject numbers don't constrain the range
+		if (!(rule->get_applicable_types() & SchemaUtil::JSON_TYPE_NUMERIC)) {
+			continue;
+		}
+		if (!rule->narrow_numeric_range(range)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RuleGroup::narrow_string_constraints(StringConstraints &constraints) const {
+	for (const std::shared_ptr<ValidationRule> &rule : rules) {
+		// Rules that never reject strings don't constrain them
+		if (!(rule->get_applicable_types() & SchemaUtil::JSON_TYPE_STRING)) {
+			continue;
+		}
+		if (!rule->narrow_string_constraints(constraints)) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -11,14 +11,38 @@ namespace godot {
 
 // Forward declarations
 class ValidationContext;
+class ValidationSnapshot;
 
 /**
  * @class RuleGroup
  * @brief Groups multiple rules that all must pass (AND logic)
+ *
+ * Rules are also partitioned by the JSON types they apply to when added,
+ * so validation runs only the rules that can reject the target's type.
  */
 class RuleGroup : public ValidationRule {
 private:
 	std::vector<std::shared_ptr<ValidationRule>> rules;
+	std::vector<const ValidationRule *> type_buckets[SchemaUtil::JSON_TYPE_COUNT]; // Rules per JSON type index, in insertion order
+	uint32_t applicable_types = 0; // Union of the rules' applicable types
+
+	/**
+	 * @brief Runs the rules that apply to the target's JSON type
+	 * @param target The value to validate
+	 * @param context Validation context for error tracking
+	 * @return True if all rules pass
+	 */
+	bool validate_rules(const Variant &target, ValidationContext &context) const;
+
+	/**
+	 * @brief Runs the rules and records the result in a snapshot
+	 * @param target The container to validate
+	 * @param container_id Identity of the container
+	 * @param snapshot The snapshot of the context
+	 * @param context Validation context for error tracking
+	 * @return True if all rules pass
+	 */
+	bool validate_and_record(const Variant &target, uintptr_t container_id, ValidationSnapshot &snapshot, ValidationContext &context) const;
 
 public:
 	void add_rule(std::shared_ptr<ValidationRule> rule);
@@ -26,7 +50,11 @@ public:
 	size_t rule_count() const { return rules.size(); }
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
+	bool narrow_numeric_range(NumericRange &range) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
 	String get_rule_type() const override { return "group"; }
+	uint32_t get_applicable_types() const override { return applicable_types; }
 	String get_description() const override;
 };
 
@@ -1,32 +1,233 @@
 #include "selector_rule.hpp"
+#include "../program/rule_program.hpp"
+#include "../util.hpp"
 #include "../validation_context.hpp"
 
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 using namespace godot;
 
+/**
+ * @brief Applies a rule to each selected value under its instance path segment
+ */
+class RuleApplyingVisitor : public SelectionVisitor {
+private:
+	const ValidationRule &rule;
+	ValidationContext &context;
+	std::atomic<bool> *stop_flag; // Shared by parallel chunks to stop each other in fail-fast mode
+
+public:
+	bool all_valid = true;
+
+	RuleApplyingVisitor(const ValidationRule &r, ValidationContext &ctx, std::atomic<bool> *stop = nullptr) :
+			rule(r), context(ctx), stop_flag(stop) {}
+
+	bool visit(const Variant &value, const PathSegment &segment) override {
+		if (stop_flag && stop_flag->load(std::memory_order_relaxed)) {
+			return false;
+		}
+
+		bool valid;
+		{
+			ValidationContext::InstanceScope scope(context, segment);
+			valid = rule.validate(value, context);
+		}
+		// Checked once the target's subtree is left, its own error budget does not stop its siblings
+		if (!valid) {
+			all_valid = false;
+			if (context.should_stop_on_failure()) {
+				if (stop_flag) {
+					stop_flag->store(true, std::memory_order_relaxed);
+				}
+				return false;
+			}
+			// Continue to validate other targets and collect all errors
+		}
+		return true;
+	}
+};
+
+/**
+ * @brief Shared state of a parallel selection, each chunk owns one forked context
+ */
+struct ParallelSelectionState {
+	const Selector *selector = nullptr;
+	const ValidationRule *rule = nullptr;
+	const Variant *target = nullptr;
+	int64_t count = 0;
+	int64_t chunk_size = 0;
+	std::vector<ValidationContext> chunk_contexts;
+	std::vector<uint8_t> chunk_valid;
+	std::atomic<bool> stop_flag{ false };
+};
+
+static void validate_selection_chunk(void *userdata, uint32_t chunk) {
+	SchemaUtil::PoolTaskScope pool_task;
+	ParallelSelectionState &state = *static_cast<ParallelSelectionState *>(userdata);
+	const int64_t begin = static_cast<int64_t>(chunk) * state.chunk_size;
+	const int64_t end = std::min(begin + state.chunk_size, state.count);
+
+	RuleApplyingVisitor visitor(*state.rule, state.chunk_contexts[chunk], &state.stop_flag);
+	state.selector->select_target_range(*state.target, begin, end, visitor);
+	state.chunk_valid[chunk] = visitor.all_valid ? 1 : 0;
+}
+
+/**
+ * @brief Validates the values a NumericRange or StringConstraints rejects, boxing only those into Variants
+ */
+template <typename T, typename Constraints>
+static bool validate_rejected_values(const T *values, int64_t size, const Constraints &constraints, const ValidationRule &rule, ValidationContext &context) {
+	bool all_valid = true;
+	for (int64_t index = constraints.find_rejected(values, 0, size); index < size; index = constraints.find_rejected(values, index + 1, size)) {
+		// The rule decides and reports the exact error, the scan may reject conservatively
+		bool valid;
+		{
+			ValidationContext::InstanceScope scope(context, PathSegment(index));
+			valid = rule.validate(Variant(values[index]), context);
+		}
+		if (!valid) {
+			all_valid = false;
+			if (context.should_stop_on_failure()) {
+				break;
+			}
+		}
+	}
+	return all_valid;
+}
+
 SelectorRule::SelectorRule(std::unique_ptr<Selector> sel, std::shared_ptr<ValidationRule> r) :
-		selector(std::move(sel)), rule(r) {}
+		selector(std::move(sel)), rule(r) {
+	if (selector && rule && selector->selects_all_items()) {
+		has_numeric_range = rule->narrow_numeric_range(numeric_range);
+		has_string_constraints = rule->narrow_string_constraints(string_constraints);
+	}
+}
+
+bool SelectorRule::validate_packed(const Variant &target, ValidationContext &context, bool &r_valid) const {
+	const Variant::Type type = target.get_type();
+	if (type == Variant::PACKED_STRING_ARRAY) {
+		if (!has_string_constraints) {
+			return false;
+		}
+		const PackedStringArray values = target;
+		r_valid = validate_rejected_values(values.ptr(), values.size(), string_constraints, *rule, context);
+		return true;
+	}
+
+	if (!has_numeric_range) {
+		return false;
+	}
+	switch (type) {
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			const PackedFloat32Array values = target;
+			r_valid = validate_rejected_values(values.ptr(), values.size(), numeric_range, *rule, context);
+			return true;
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			const PackedFloat64Array values = target;
+			r_valid = validate_rejected_values(values.ptr(), values.size(), numeric_range, *rule, context);
+			return true;
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			const PackedInt32Array values = target;
+			r_valid = validate_rejected_values(values.ptr(), values.size(), numeric_range, *rule, context);
+			return true;
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			const PackedInt64Array values = target;
+			r_valid = validate_rejected_values(values.ptr(), values.size(), numeric_range, *rule, context);
+			return true;
+		}
+		default:
+			return false;
+	}
+}
 
 bool SelectorRule::validate(const Variant &target, ValidationContext &context) const {
 	if (!selector || !rule) {
-		context.add_error("Internal error: invalid selector rule");
+		context.report_error("", Variant(), "Internal error: invalid selector rule");
 		return false;
 	}
 
-	std::vector<SelectionTarget> targets = selector->select_targets(target, context);
-	bool all_valid = true;
+	bool packed_valid = true;
+	if (validate_packed(target, context, packed_valid)) {
+		return packed_valid;
+	}
 
-	for (const auto &selection : targets) {
-		ValidationContext child_context = context.create_child_instance(selection.path_segment);
-		if (!rule->validate(selection.value, child_context)) {
-			all_valid = false;
-			// Continue to validate other targets and collect all errors
+	// Large selections are split across worker threads, error budgets need the sequential order
+	const int64_t parallel_threshold = context.get_parallel_items_threshold();
+	if (parallel_threshold > 0 && !context.has_error_limits()) {
+		const int64_t count = selector->get_range_target_count(target);
+		if (count >= parallel_threshold && count >= 2 * MIN_PARALLEL_CHUNK_SIZE) {
+			return validate_parallel(target, count, context);
 		}
-		context.merge_errors(child_context);
 	}
 
+	RuleApplyingVisitor visitor(*rule, context);
+	selector->select_targets(target, context, visitor);
+	return visitor.all_valid;
+}
+
+bool SelectorRule::validate_parallel(const Variant &target, int64_t count, ValidationContext &context) const {
+	ParallelSelectionState state;
+	state.selector = selector.get();
+	state.rule = rule.get();
+	state.target = &target;
+	state.count = count;
+
+	// A few chunks per core to balance uneven items
+	const int64_t target_chunks = OS::get_singleton()->get_processor_count() * 4;
+	state.chunk_size = std::max<int64_t>((count + target_chunks - 1) / target_chunks, MIN_PARALLEL_CHUNK_SIZE);
+	const int64_t chunk_count = (count + state.chunk_size - 1) / state.chunk_size;
+
+	state.chunk_contexts.reserve(chunk_count);
+	for (int64_t i = 0; i < chunk_count; i++) {
+		state.chunk_contexts.push_back(context.fork());
+	}
+	state.chunk_valid.resize(chunk_count, 1);
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int64_t group_id = pool->add_native_group_task(&validate_selection_chunk, &state, static_cast<int>(chunk_count), -1, true, "Schema array items validation");
+	pool->wait_for_group_task_completion(group_id);
+
+	// Merge in target order so errors match sequential validation
+	bool all_valid = true;
+	for (int64_t i = 0; i < chunk_count; i++) {
+		if (!state.chunk_valid[i]) {
+			all_valid = false;
+		}
+		context.join(state.chunk_contexts[i]);
+	}
 	return all_valid;
 }
 
+void SelectorRule::lower(RuleProgramBuilder &builder) const {
+	if (!selector || !rule) {
+		builder.emit_call(this);
+		return;
+	}
+
+	// Packed arrays checked in place skip the selection
+	const bool checks_packed = has_numeric_range || has_string_constraints;
+	if (checks_packed) {
+		builder.begin_packed_check(this);
+	}
+
+	// Selectors without an instruction form run the whole selector rule as a call
+	if (!selector->lower(builder, *rule)) {
+		builder.emit_call(this);
+	}
+
+	if (checks_packed) {
+		builder.end_packed_check();
+	}
+}
+
 String SelectorRule::get_description() const {
 	if (!selector || !rule) {
 		return "invalid_selector_rule";
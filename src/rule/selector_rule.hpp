@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../selector/selector.hpp"
+#include "numeric_range.hpp"
+#include "string_constraints.hpp"
 #include "validation_rule.hpp"
 
 #include <godot_cpp/variant/variant.hpp>
@@ -21,12 +23,41 @@ class SelectorRule : public ValidationRule {
 private:
 	std::unique_ptr<Selector> selector;
 	std::shared_ptr<ValidationRule> rule;
+	NumericRange numeric_range; // Constraints of a number-only rule, used to scan packed numeric arrays
+	bool has_numeric_range = false;
+	StringConstraints string_constraints; // Constraints of a string-only rule, used to check PackedStringArray items
+	bool has_string_constraints = false;
+
+	/**
+	 * @brief Validates the selected targets in chunks on the WorkerThreadPool
+	 * @param target The value to select from
+	 * @param count Number of targets reported by Selector::get_range_target_count()
+	 * @param context Validation context, receives chunk errors in target order
+	 * @return True if all targets pass
+	 */
+	bool validate_parallel(const Variant &target, int64_t count, ValidationContext &context) const;
 
 public:
+	/**
+	 * @brief Smallest number of targets validated by one worker task
+	 */
+	static constexpr int64_t MIN_PARALLEL_CHUNK_SIZE = 256;
+
 	SelectorRule(std::unique_ptr<Selector> sel, std::shared_ptr<ValidationRule> r);
 
+	/**
+	 * @brief Validates the items of a packed array by checking its buffer in place
+	 * @param target The value to select from
+	 * @param context Validation context, only items rejected by the check are validated by the rule
+	 * @param r_valid Receives true if all items pass
+	 * @return False if the target is not a packed array this rule can check in place
+	 */
+	bool validate_packed(const Variant &target, ValidationContext &context, bool &r_valid) const;
+
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
 	String get_rule_type() const override { return "selector"; }
+	uint32_t get_applicable_types() const override { return selector->get_applicable_types(*rule); }
 	String get_description() const override;
 };
 
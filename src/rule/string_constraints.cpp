@@ -0,0 +1,50 @@
+#include "string_constraints.hpp"
+#include "../util.hpp"
+#include "../validation_context.hpp"
+#include "format_rule.hpp"
+#include "pattern_rule.hpp"
+
+using namespace godot;
+
+bool StringConstraints::accepts(const String &value, ValidationContext &scratch) const {
+	if (!strings_allowed) {
+		return false;
+	}
+
+	// Counting UTF-8 bytes is cheaper than the hash lookup and regex checks below
+	if (min_length > 0 || max_length < std::numeric_limits<int64_t>::max()) {
+		const int64_t length = SchemaUtil::utf8_length(value);
+		if (length < min_length || length > max_length) {
+			return false;
+		}
+	}
+
+	if (allowed_values && allowed_values->find(value) == allowed_values->end()) {
+		return false;
+	}
+
+	for (const PatternRule *pattern : patterns) {
+		if (!pattern->matches(value)) {
+			return false;
+		}
+	}
+
+	for (const FormatRule *format : formats) {
+		if (!format->matches(value, scratch)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int64_t StringConstraints::find_rejected(const String *values, int64_t begin, int64_t end) const {
+	// Format checks report through a context, one serves the whole scan
+	ValidationContext scratch(nullptr, false);
+	for (int64_t i = begin; i < end; i++) {
+		if (!accepts(values[i], scratch)) {
+			return i;
+		}
+	}
+	return end;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../hashers.hpp"
+
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace godot {
+
+// Forward declarations
+class FormatRule;
+class PatternRule;
+class ValidationContext;
+
+/**
+ * @struct StringConstraints
+ * @brief String constraints of a schema, checked directly on PackedStringArray buffers
+ *
+ * Built by ValidationRule::narrow_string_constraints() for item schemas that
+ * only constrain strings. find_rejected() checks the Strings in place, without
+ * boxing them into Variants or converting them to UTF-8. Rejected values are
+ * validated again by the rules, which report the exact error.
+ */
+struct StringConstraints {
+	bool strings_allowed = true; // False if "type" rejects strings
+	int64_t min_length = 0; // UTF-8 bytes
+	int64_t max_length = std::numeric_limits<int64_t>::max(); // UTF-8 bytes
+	const std::unordered_set<String, StringHasher> *allowed_values = nullptr; // String members of an "enum", null if not constrained
+	std::vector<const PatternRule *> patterns;
+	std::vector<const FormatRule *> formats;
+
+	/**
+	 * @brief Checks if a string passes all constraints
+	 * @param value The string
+	 * @param scratch Context that does not collect errors, used by format checks
+	 * @return True if the string is accepted
+	 */
+	bool accepts(const String &value, ValidationContext &scratch) const;
+
+	/**
+	 * @brief Finds the first rejected string in [begin, end)
+	 * @param values The string buffer
+	 * @param begin First index to check
+	 * @param end One past the last index to check
+	 * @return Index of the first rejected string, or end if all are accepted
+	 */
+	int64_t find_rejected(const String *values, int64_t begin, int64_t end) const;
+};
+
+} // namespace godot
@@ -1,36 +1,37 @@
 #include "type_rule.hpp"
+#include "../program/rule_program.hpp"
 #include "../util.hpp"
 #include "../validation_context.hpp"
+#include "numeric_range.hpp"
+#include "string_constraints.hpp"
 
 using namespace godot;
 
 TypeRule::TypeRule(const String &type) {
 	allowed_types.push_back(type);
+	allowed_type_flags = SchemaUtil::get_json_type_flags(type);
+	allowed_type_names.push_back(type);
 }
 
 TypeRule::TypeRule(const std::vector<String> &types) :
-		allowed_types(types) {}
+		allowed_types(types) {
+	for (const String &type : allowed_types) {
+		allowed_type_flags |= SchemaUtil::get_json_type_flags(type);
+		allowed_type_names.push_back(type);
+	}
+}
 
 bool TypeRule::validate(const Variant &target, ValidationContext &context) const {
-	String actual_type = SchemaUtil::get_variant_json_type(target);
-
 	// Check if actual type matches any allowed type
-	for (const String &allowed_type : allowed_types) {
-		if (is_type_compatible(target, allowed_type)) {
-			return true;
-		}
+	if (SchemaUtil::get_variant_json_type_flag(target) & allowed_type_flags) {
+		return true;
 	}
 
-	// No match found - build error message
-	String allowed_str;
-	for (size_t i = 0; i < allowed_types.size(); i++) {
-		if (i > 0) {
-			allowed_str += ", ";
-		}
-		allowed_str += allowed_types[i];
+	if (!context.is_collecting_errors()) {
+		return false;
 	}
 
-	context.add_error(vformat("Value has type %s but expected one of: %s", actual_type, allowed_str), "type", target);
+	context.report_error("type", target, "Value has type %s but expected one of: %s", SchemaUtil::get_variant_json_type(target), ValidationError::MessageList{ allowed_type_names });
 
 	return false;
 }
@@ -51,18 +52,18 @@ String TypeRule::get_description() const {
 	}
 }
 
-bool TypeRule::is_type_compatible(const Variant &instance, const String &schema_type) const {
-	String actual_type = SchemaUtil::get_variant_json_type(instance);
+void TypeRule::lower(RuleProgramBuilder &builder) const {
+	builder.emit_check(OP_CHECK_TYPE, this, allowed_type_flags);
+}
 
-	// Direct match
-	if (actual_type == schema_type) {
-		return true;
-	}
+bool TypeRule::narrow_numeric_range(NumericRange &range) const {
+	range.type_flags &= allowed_type_flags;
+	return true;
+}
 
-	// Integer is compatible with number type
-	if (schema_type == "number" && actual_type == "integer") {
-		return true;
+bool TypeRule::narrow_string_constraints(StringConstraints &constraints) const {
+	if (!(allowed_type_flags & SchemaUtil::JSON_TYPE_STRING)) {
+		constraints.strings_allowed = false;
 	}
-
-	return false;
+	return true;
 }
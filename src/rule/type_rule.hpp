@@ -20,14 +20,17 @@ class ValidationContext;
 class TypeRule : public ValidationRule {
 private:
 	std::vector<String> allowed_types;
-
-	bool is_type_compatible(const Variant &instance, const String &schema_type) const;
+	uint32_t allowed_type_flags = 0; // SchemaUtil::JsonTypeFlags accepted by allowed_types
+	Array allowed_type_names; // allowed_types as an error message argument
 
 public:
 	explicit TypeRule(const String &type);
 	explicit TypeRule(const std::vector<String> &types);
 
 	bool validate(const Variant &target, ValidationContext &context) const override;
+	void lower(RuleProgramBuilder &builder) const override;
+	bool narrow_numeric_range(NumericRange &range) const override;
+	bool narrow_string_constraints(StringConstraints &constraints) const override;
 	String get_rule_type() const override { return "type"; }
 	String get_description() const override;
 };
@@ -22,8 +22,9 @@ bool UniqueItemsRule::validate(const Variant &target, ValidationContext &context
 
 			if (current_item == seen_item ||
 					(should_hash_variant(current_item) && current_item.hash_compare(seen_item))) {
-				context.add_error(vformat("Array contains duplicate item at index %d: %s", i, current_item.stringify()),
-						"uniqueItems", target);
+				if (context.is_collecting_errors()) {
+					context.report_error("uniqueItems", target, "Array contains duplicate item at index %d: %s", i, ValidationError::MessageData{ current_item });
+				}
 				return false;
 			}
 		}
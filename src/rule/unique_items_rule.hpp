@@ -17,6 +17,7 @@ public:
 	bool validate(const Variant &target, ValidationContext &context) const override;
 
 	String get_rule_type() const override { return "uniqueItems"; }
+	uint32_t get_applicable_types() const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override { return "uniqueItems"; }
 };
 
@@ -1,12 +1,17 @@
 #pragma once
 
+#include "../util.hpp"
+
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 namespace godot {
 
 // Forward declarations
+class RuleProgramBuilder;
 class ValidationContext;
+struct NumericRange;
+struct StringConstraints;
 
 /**
  * @class ValidationRule
@@ -41,6 +46,41 @@ public:
 	 * @return True if rule imposes no constraints (always passes)
 	 */
 	virtual bool is_empty() const { return false; }
+
+	/**
+	 * @brief Gets the JSON types this rule can reject
+	 * @return SchemaUtil::JsonTypeFlags of the values the rule has to run for
+	 *
+	 * Values of any other type always pass, so a RuleGroup skips the rule for them.
+	 */
+	virtual uint32_t get_applicable_types() const { return SchemaUtil::JSON_TYPE_ANY; }
+
+	/**
+	 * @brief Lowers this rule into a linearized rule program
+	 * @param builder Builder receiving the instructions
+	 *
+	 * The default emits a call to validate(), rules with a dedicated
+	 * instruction override this to emit it inline.
+	 */
+	virtual void lower(RuleProgramBuilder &builder) const;
+
+	/**
+	 * @brief Narrows a numeric range to this rule's constraints on numbers
+	 * @param range Range to narrow
+	 * @return False if the rule cannot be expressed as a NumericRange
+	 *
+	 * Lets packed numeric arrays be scanned without boxing their items.
+	 */
+	virtual bool narrow_numeric_range(NumericRange &range) const { return false; }
+
+	/**
+	 * @brief Narrows string constraints to this rule's constraints on strings
+	 * @param constraints Constraints to narrow
+	 * @return False if the rule cannot be expressed as StringConstraints
+	 *
+	 * Lets PackedStringArray items be checked without boxing them.
+	 */
+	virtual bool narrow_string_constraints(StringConstraints &constraints) const { return false; }
 };
 
 } // namespace godot
@@ -22,6 +22,7 @@
 #include "rule/minimum_rule.hpp"
 #include "rule/multiple_of_rule.hpp"
 #include "rule/not_rule.hpp"
+#include "rule/object_rule.hpp"
 #include "rule/one_of_rule.hpp"
 #include "rule/pattern_rule.hpp"
 #include "rule/ref_rule.hpp"
@@ -32,22 +33,248 @@
 #include "rule/unique_items_rule.hpp"
 #include "schema.hpp"
 #include "selector/additional_items_selector.hpp"
-#include "selector/additional_properties_selector.hpp"
 #include "selector/array_item_selector.hpp"
 #include "selector/array_items_selector.hpp"
-#include "selector/object_keys_selector.hpp"
 #include "selector/object_values_selector.hpp"
-#include "selector/pattern_properties_selector.hpp"
-#include "selector/property_selector.hpp"
-#include "selector/value_selector.hpp"
 #include "util.hpp"
 
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+
+#include <algorithm>
+#include <iterator>
+
 using namespace godot;
 
+thread_local std::unordered_set<const Schema *> RuleFactory::compiling_schemas;
+thread_local std::vector<RuleFactory::PendingRef> RuleFactory::pending_refs;
+thread_local int RuleFactory::compile_depth = 0;
+
 RuleFactory::RuleCompileResult RuleFactory::create_rules(const Ref<Schema> &schema) {
 	RuleCompileResult result;
+
+	// Large documents fan their sub-schemas out first, the root then reuses them
+	if (compile_depth == 0 && schema->is_root()) {
+		compile_subschemas_parallel(schema);
+	}
+
+	compile_depth++;
+	try {
+		result = compile_schema(schema);
+	} catch (...) {
+		compile_depth--;
+		throw;
+	}
+	compile_depth--;
+
+	// Every Schema reachable from the outermost compilation is published now
+	if (compile_depth == 0) {
+		link_pending_refs();
+	}
+
+	return result;
+}
+
+void RuleFactory::compile_subschemas_parallel(const Ref<Schema> &schema) {
+	const int64_t threshold = parallel_compile_threshold.load(std::memory_order_relaxed);
+	if (threshold <= 0 || schema->get_compiled_state() || schema->get_schema_definition().has("$ref")) {
+		return; // Disabled, already compiled, or the siblings of $ref are ignored
+	}
+
+	ParallelCompileState state;
+	state.schemas.reserve(schema->children.size());
+	for (const auto &child : schema->children) {
+		state.schemas.push_back(child.second);
+	}
+	if (state.schemas.size() < 2 || static_cast<int64_t>(state.schemas.size()) < threshold) {
+		return;
+	}
+
+	// Waiting inside a pool task would hold its worker, compile serially there
+	if (SchemaUtil::is_in_pool_task()) {
+		return;
+	}
+	state.pending_refs.resize(state.schemas.size());
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int64_t group_id = pool->add_native_group_task(&compile_subschema_task, &state, static_cast<int>(state.schemas.size()), -1, true, "Schema compilation");
+	pool->wait_for_group_task_completion(group_id);
+
+	// Linked with the references of the root once it is compiled
+	for (std::vector<PendingRef> &refs : state.pending_refs) {
+		pending_refs.insert(pending_refs.end(), std::make_move_iterator(refs.begin()), std::make_move_iterator(refs.end()));
+	}
+}
+
+void RuleFactory::compile_subschema_task(void *userdata, uint32_t index) {
+	SchemaUtil::PoolTaskScope pool_task;
+	ParallelCompileState &state = *static_cast<ParallelCompileState *>(userdata);
+
+	// The task may run on a thread that is compiling something else
+	std::vector<PendingRef> outer_refs;
+	outer_refs.swap(pending_refs);
+
+	// Nested depth so create_rules() queues references instead of linking them
+	compile_depth++;
+	get_singleton().create_rules(state.schemas[index]);
+	compile_depth--;
+
+	state.pending_refs[index].swap(pending_refs);
+	pending_refs.swap(outer_refs);
+}
+
+void RuleFactory::link_pending_refs() {
+	// Linking can compile further schemas, which queue and link their own references
+	while (!pending_refs.empty()) {
+		std::vector<PendingRef> batch;
+		batch.swap(pending_refs);
+		for (const PendingRef &pending : batch) {
+			// Unresolvable references stay unlinked and retry when validated
+			pending.rule->link();
+		}
+	}
+}
+
+uint64_t RuleFactory::get_intern_scope(const Ref<Schema> &schema) {
+	return schema->has_references() ? schema->get_root()->get_instance_id() : 0;
+}
+
+std::shared_ptr<RuleGroup> RuleFactory::find_interned_rules(const Ref<Schema> &schema) {
+	const uint64_t scope = get_intern_scope(schema);
+
+	cache_mutex->lock();
+	std::shared_ptr<RuleGroup> rules;
+	const auto bucket = rule_cache_index.find(schema->get_content_hash());
+	if (bucket != rule_cache_index.end()) {
+		for (const auto &entry : bucket->second) {
+			// Deep comparison, only reached for equal hashes
+			if (entry->scope == scope && entry->definition == schema->get_schema_definition()) {
+				rules = entry->rules;
+				rule_cache.splice(rule_cache.begin(), rule_cache, entry);
+				break;
+			}
+		}
+	}
+	if (rules) {
+		cache_hits++;
+	} else {
+		cache_misses++;
+	}
+	cache_mutex->unlock();
+
+	return rules;
+}
+
+void RuleFactory::intern_rules(const Ref<Schema> &schema, const std::shared_ptr<RuleGroup> &rules) {
+	const uint64_t scope = get_intern_scope(schema);
+	const uint64_t content_hash = schema->get_content_hash();
+
+	cache_mutex->lock();
+	std::vector<std::list<InternedRules>::iterator> &bucket = rule_cache_index[content_hash];
+	bool interned = false;
+	for (const auto &entry : bucket) {
+		if (entry->scope == scope && entry->definition == schema->get_schema_definition()) {
+			interned = true;
+			break;
+		}
+	}
+	if (!interned) {
+		const size_t bytes = estimate_memory_usage(*rules);
+		rule_cache.push_front({ content_hash, schema->get_schema_definition(), scope, rules, bytes });
+		bucket.push_back(rule_cache.begin());
+		cache_bytes += bytes;
+		evict_interned_rules();
+	}
+	cache_mutex->unlock();
+}
+
+void RuleFactory::evict_interned_rules() {
+	const size_t capacity = static_cast<size_t>(cache_capacity);
+	const size_t max_bytes = static_cast<size_t>(cache_max_bytes);
+
+	while (!rule_cache.empty() && (rule_cache.size() > capacity || (max_bytes > 0 && cache_bytes > max_bytes))) {
+		const auto oldest = std::prev(rule_cache.end());
+
+		auto bucket = rule_cache_index.find(oldest->content_hash);
+		if (bucket != rule_cache_index.end()) {
+			std::vector<std::list<InternedRules>::iterator> &entries = bucket->second;
+			entries.erase(std::remove(entries.begin(), entries.end(), oldest), entries.end());
+			if (entries.empty()) {
+				rule_cache_index.erase(bucket);
+			}
+		}
+
+		// Schemas compiled with these rules keep them alive
+		cache_bytes -= oldest->bytes;
+		rule_cache.erase(oldest);
+		cache_evictions++;
+	}
+}
+
+size_t RuleFactory::estimate_memory_usage(const RuleGroup &rules) {
+	return sizeof(InternedRules) + sizeof(RuleGroup) + rules.rule_count() * ESTIMATED_RULE_BYTES;
+}
+
+void RuleFactory::set_cache_capacity(int64_t capacity) {
+	cache_mutex->lock();
+	cache_capacity = capacity;
+	evict_interned_rules();
+	cache_mutex->unlock();
+}
+
+int64_t RuleFactory::get_cache_capacity() {
+	cache_mutex->lock();
+	const int64_t capacity = cache_capacity;
+	cache_mutex->unlock();
+	return capacity;
+}
+
+void RuleFactory::set_cache_max_bytes(int64_t max_bytes) {
+	cache_mutex->lock();
+	cache_max_bytes = max_bytes;
+	evict_interned_rules();
+	cache_mutex->unlock();
+}
+
+int64_t RuleFactory::get_cache_max_bytes() {
+	cache_mutex->lock();
+	const int64_t max_bytes = cache_max_bytes;
+	cache_mutex->unlock();
+	return max_bytes;
+}
+
+void RuleFactory::clear_cache() {
+	cache_mutex->lock();
+	rule_cache.clear();
+	rule_cache_index.clear();
+	cache_bytes = 0;
+	cache_mutex->unlock();
+}
+
+Dictionary RuleFactory::get_cache_stats() {
+	Dictionary stats;
+	cache_mutex->lock();
+	stats["entries"] = static_cast<int64_t>(rule_cache.size());
+	stats["bytes"] = static_cast<int64_t>(cache_bytes);
+	stats["hits"] = static_cast<int64_t>(cache_hits);
+	stats["misses"] = static_cast<int64_t>(cache_misses);
+	stats["evictions"] = static_cast<int64_t>(cache_evictions);
+	cache_mutex->unlock();
+	return stats;
+}
+
+RuleFactory::RuleCompileResult RuleFactory::compile_schema(const Ref<Schema> &schema) {
+	RuleCompileResult result;
+
+	// Compiled earlier, e.g. by compile_subschemas_parallel()
+	if (const Schema::CompiledState *state = schema->get_compiled_state()) {
+		if (state->rules) {
+			result.rules = state->rules;
+		}
+		result.errors = state->errors;
+		return result;
+	}
+
 	Dictionary schema_def = schema->get_schema_definition();
-	int64_t hash = schema_def.hash();
 
 	// UtilityFunctions::print("Create Rules: ", schema_def);
 
@@ -58,36 +285,24 @@ RuleFactory::RuleCompileResult RuleFactory::create_rules(const Ref<Schema> &sche
 		return result;
 	}
 
-	cache_mutex->lock();
-
 	// Check compilation cycle
-	bool is_cycling = compiling_schemas.find(hash) != compiling_schemas.end();
+	bool is_cycling = compiling_schemas.find(schema.ptr()) != compiling_schemas.end();
 	if (is_cycling) {
-		cache_mutex->unlock();
 		return result; // Empty rules to break cycle
 	}
 
-	// Check cache first
-	auto cache_it = rule_cache.find(hash);
-	if (cache_it != rule_cache.end()) {
-		result.rules = cache_it->second;
-		cache_mutex->unlock();
-
-		// Update Schema atomically ONLY if not already compiled
-		schema->compilation_mutex->lock();
-		if (!schema->is_compiled) {
-			schema->rules = result.rules;
-			schema->compile_errors.clear(); // No errors for cached successful compilation
-			schema->is_compiled = true;
-		}
+	// Check interned rules first
+	std::shared_ptr<RuleGroup> interned = find_interned_rules(schema);
+	if (interned) {
+		result.rules = interned;
 
-		schema->compilation_mutex->unlock();
+		// No errors for cached successful compilation, ignored if already compiled
+		schema->set_compilation_result(result.rules, {});
 		return result;
 	}
 
 	// Mark as compiling
-	compiling_schemas.insert(hash);
-	cache_mutex->unlock();
+	compiling_schemas.insert(schema.ptr());
 
 	// Compile the Schema
 	try {
@@ -105,27 +320,19 @@ RuleFactory::RuleCompileResult RuleFactory::create_rules(const Ref<Schema> &sche
 
 		// Cache successful results
 		if (result.is_valid()) {
-			cache_mutex->lock();
-			if (rule_cache.find(hash) == rule_cache.end()) {
-				rule_cache[hash] = result.rules;
-			}
-			cache_mutex->unlock();
+			intern_rules(schema, result.rules);
 		}
 
 		// Update Schema atomically (whether valid or not)
 		schema->set_compilation_result(result.rules, result.errors);
 	} catch (...) {
 		// Ensure cleanup on exception
-		cache_mutex->lock();
-		compiling_schemas.erase(hash);
-		cache_mutex->unlock();
+		compiling_schemas.erase(schema.ptr());
 		throw;
 	}
 
 	// Clean up compilation state
-	cache_mutex->lock();
-	compiling_schemas.erase(hash);
-	cache_mutex->unlock();
+	compiling_schemas.erase(schema.ptr());
 
 	return result;
 }
@@ -145,22 +352,18 @@ void RuleFactory::create_ref_rules(const Ref<Schema> schema, const Dictionary &r
 		return;
 	}
 
-	// Create RefRule that will handle resolution and validation at runtime
-	auto selector = std::make_unique<ValueSelector>();
+	// Linked to the target rules once the outermost compilation finishes
 	auto ref_rule = std::make_unique<RefRule>(ref_uri, schema.ptr());
+	pending_refs.push_back({ result.rules, ref_rule.get() });
 
-	// UtilityFunctions::print("Created $ref ", ref_uri);
-
-	result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(ref_rule)));
+	result.rules->add_rule(std::move(ref_rule));
 }
 
 void RuleFactory::create_type_rules(const Variant &type_def, RuleCompileResult &result) {
 	if (type_def.get_type() == Variant::STRING) {
 		// Single type
 		String type_str = type_def.operator String();
-		auto selector = std::make_unique<ValueSelector>();
-		auto rule = std::make_unique<TypeRule>(type_str);
-		result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+		result.rules->add_rule(std::make_unique<TypeRule>(type_str));
 
 	} else if (type_def.get_type() == Variant::ARRAY) {
 		// Array of types
@@ -177,9 +380,7 @@ void RuleFactory::create_type_rules(const Variant &type_def, RuleCompileResult &
 		}
 
 		if (!types.empty()) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<TypeRule>(types);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<TypeRule>(types));
 		}
 	}
 	// Note: Meta-validation already ensures type is string or array, so no else case needed
@@ -191,9 +392,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant min_length_var = schema_def["minLength"];
 		int64_t min_length;
 		if (try_get_non_negative_int(min_length_var, min_length)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MinLengthRule>(min_length);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MinLengthRule>(min_length));
 		}
 	}
 
@@ -202,9 +401,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant max_length_var = schema_def["maxLength"];
 		int64_t max_length;
 		if (try_get_non_negative_int(max_length_var, max_length)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MaxLengthRule>(max_length);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MaxLengthRule>(max_length));
 		}
 	}
 
@@ -213,9 +410,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant pattern_var = schema_def["pattern"];
 		if (pattern_var.get_type() == Variant::STRING) {
 			String pattern_str = pattern_var.operator String();
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<PatternRule>(pattern_str);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<PatternRule>(pattern_str));
 		}
 	}
 
@@ -224,9 +419,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant format_var = schema_def["format"];
 		if (format_var.get_type() == Variant::STRING) {
 			String format = format_var.operator String();
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<FormatRule>(format);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<FormatRule>(format));
 		}
 	}
 
@@ -235,9 +428,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant format_var = schema_def["contentEncoding"];
 		if (format_var.get_type() == Variant::STRING) {
 			String format = format_var.operator String();
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<ContentEncodingRule>(format);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<ContentEncodingRule>(format));
 		}
 	}
 
@@ -246,9 +437,7 @@ void RuleFactory::create_string_rules(const Dictionary &schema_def, RuleCompileR
 		Variant format_var = schema_def["contentMediaType"];
 		if (format_var.get_type() == Variant::STRING) {
 			String format = format_var.operator String();
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<ContentMediaTypeRule>(format);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<ContentMediaTypeRule>(format));
 		}
 	}
 }
@@ -259,9 +448,7 @@ void RuleFactory::create_numeric_rules(const Dictionary &schema_def, RuleCompile
 		Variant minimum_var = schema_def["minimum"];
 		double minimum;
 		if (try_get_numeric_value(minimum_var, minimum)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MinimumRule>(minimum);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MinimumRule>(minimum));
 		}
 	}
 
@@ -270,9 +457,7 @@ void RuleFactory::create_numeric_rules(const Dictionary &schema_def, RuleCompile
 		Variant maximum_var = schema_def["maximum"];
 		double maximum;
 		if (try_get_numeric_value(maximum_var, maximum)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MaximumRule>(maximum);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MaximumRule>(maximum));
 		}
 	}
 
@@ -281,9 +466,7 @@ void RuleFactory::create_numeric_rules(const Dictionary &schema_def, RuleCompile
 		Variant exclusive_minimum_var = schema_def["exclusiveMinimum"];
 		double exclusive_minimum;
 		if (try_get_numeric_value(exclusive_minimum_var, exclusive_minimum)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<ExclusiveMinimumRule>(exclusive_minimum);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<ExclusiveMinimumRule>(exclusive_minimum));
 		}
 	}
 
@@ -292,9 +475,7 @@ void RuleFactory::create_numeric_rules(const Dictionary &schema_def, RuleCompile
 		Variant exclusive_maximum_var = schema_def["exclusiveMaximum"];
 		double exclusive_maximum;
 		if (try_get_numeric_value(exclusive_maximum_var, exclusive_maximum)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<ExclusiveMaximumRule>(exclusive_maximum);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<ExclusiveMaximumRule>(exclusive_maximum));
 		}
 	}
 
@@ -303,9 +484,7 @@ void RuleFactory::create_numeric_rules(const Dictionary &schema_def, RuleCompile
 		Variant multiple_of_var = schema_def["multipleOf"];
 		double multiple_of;
 		if (try_get_numeric_value(multiple_of_var, multiple_of)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MultipleOfRule>(multiple_of);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MultipleOfRule>(multiple_of));
 		}
 	}
 }
@@ -314,9 +493,7 @@ void RuleFactory::create_value_rules(const Dictionary &schema_def, RuleCompileRe
 	// const
 	if (schema_def.has("const")) {
 		Variant const_value = schema_def["const"];
-		auto selector = std::make_unique<ValueSelector>();
-		auto rule = std::make_unique<ConstRule>(const_value);
-		result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+		result.rules->add_rule(std::make_unique<ConstRule>(const_value));
 	}
 
 	// enum
@@ -324,9 +501,7 @@ void RuleFactory::create_value_rules(const Dictionary &schema_def, RuleCompileRe
 		Variant enum_var = schema_def["enum"];
 		if (enum_var.get_type() == Variant::ARRAY) {
 			Array enum_values = enum_var.operator Array();
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<EnumRule>(enum_values);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<EnumRule>(enum_values));
 		}
 	}
 
@@ -343,9 +518,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 		Variant min_props_var = schema_def["minProperties"];
 		int64_t min_props;
 		if (try_get_non_negative_int(min_props_var, min_props)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MinPropertiesRule>(min_props);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MinPropertiesRule>(min_props));
 		}
 	}
 
@@ -354,9 +527,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 		Variant max_props_var = schema_def["maxProperties"];
 		int64_t max_props;
 		if (try_get_non_negative_int(max_props_var, max_props)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MaxPropertiesRule>(max_props);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MaxPropertiesRule>(max_props));
 		}
 	}
 
@@ -374,13 +545,14 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 			}
 
 			if (!required_props.empty()) {
-				auto selector = std::make_unique<ValueSelector>();
-				auto rule = std::make_unique<RequiredPropertiesRule>(required_props);
-				result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+				result.rules->add_rule(std::make_unique<RequiredPropertiesRule>(required_props));
 			}
 		}
 	}
 
+	// properties, patternProperties, additionalProperties and propertyNames share one pass over the keys
+	auto object_rule = std::make_shared<ObjectRule>();
+
 	// properties - create rules for each property
 	if (schema_def.has("properties")) {
 		Variant props_var = schema_def["properties"];
@@ -389,9 +561,10 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 			Array keys = properties.keys();
 
 			for (int i = 0; i < keys.size(); i++) {
-				StringName prop_name = keys[i];
+				String prop_name = keys[i];
 				StringName child_name = vformat("properties/%s", prop_name);
 				Ref<Schema> child_schema = schema->get_child(child_name);
+				std::shared_ptr<ValidationRule> property_rule;
 				if (child_schema.is_valid()) {
 					// Recursively create rules for the child Schema
 					auto child_result = create_rules(child_schema);
@@ -399,12 +572,13 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 					// Merge any compilation errors
 					result.errors.insert(result.errors.end(), child_result.errors.begin(), child_result.errors.end());
 
-					// If child Schema is valid, create a selector rule for this property
 					if (child_result.is_valid() && !child_result.rules->is_empty()) {
-						auto selector = std::make_unique<PropertySelector>(prop_name);
-						result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(child_result.rules)));
+						property_rule = child_result.rules;
 					}
 				}
+
+				// Declared even without constraints so it is not treated as an additional property
+				object_rule->add_property(prop_name, property_rule);
 			}
 		}
 	}
@@ -417,8 +591,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 			result.errors.insert(result.errors.end(), prop_names_result.errors.begin(), prop_names_result.errors.end());
 
 			if (prop_names_result.is_valid() && !prop_names_result.rules->is_empty()) {
-				auto selector = std::make_unique<ObjectKeysSelector>();
-				result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(prop_names_result.rules)));
+				object_rule->set_property_names_rule(prop_names_result.rules);
 			}
 		}
 	}
@@ -433,6 +606,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 			for (int i = 0; i < patterns.size(); i++) {
 				String pattern = patterns[i].operator String();
 				Variant pattern_schema_var = pattern_properties[patterns[i]];
+				std::shared_ptr<ValidationRule> pattern_rule;
 
 				if (pattern_schema_var.get_type() == Variant::DICTIONARY) {
 					StringName child_path = vformat("patternProperties/%s", pattern);
@@ -442,11 +616,13 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 						result.errors.insert(result.errors.end(), pattern_result.errors.begin(), pattern_result.errors.end());
 
 						if (pattern_result.is_valid() && !pattern_result.rules->is_empty()) {
-							auto selector = std::make_unique<PatternPropertiesSelector>(pattern);
-							result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(pattern_result.rules)));
+							pattern_rule = pattern_result.rules;
 						}
 					}
 				}
+
+				// Matching keys are never additional properties, even without constraints
+				object_rule->add_pattern_property(pattern, pattern_rule);
 			}
 		}
 	}
@@ -457,66 +633,25 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 
 		if (additional_props_var.get_type() == Variant::BOOL && !additional_props_var.operator bool()) {
 			// additionalProperties: false - no additional properties allowed
-			// Collect defined properties and pattern properties
-			std::vector<StringName> defined_properties;
-			std::vector<String> pattern_properties_list;
-
-			if (schema_def.has("properties")) {
-				Dictionary properties = schema_def["properties"].operator Dictionary();
-				Array prop_keys = properties.keys();
-				for (int i = 0; i < prop_keys.size(); i++) {
-					defined_properties.push_back(StringName(prop_keys[i].operator String()));
-				}
-			}
-
-			if (schema_def.has("patternProperties")) {
-				Dictionary pattern_properties = schema_def["patternProperties"].operator Dictionary();
-				Array pattern_keys = pattern_properties.keys();
-				for (int i = 0; i < pattern_keys.size(); i++) {
-					pattern_properties_list.push_back(pattern_keys[i].operator String());
-				}
-			}
-
-			// Create a rule that fails validation for any additional properties
-			auto selector = std::make_unique<AdditionalPropertiesSelector>(defined_properties, pattern_properties_list);
-			auto rule = std::make_unique<ConstRule>(Variant()); // This will always fail since no value equals null in this context
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			object_rule->set_additional_properties_allowed(false);
 		} else if (additional_props_var.get_type() == Variant::DICTIONARY) {
 			// additionalProperties: {...} - additional properties must match this Schema
-			Dictionary additional_schema = additional_props_var.operator Dictionary();
 			Ref<Schema> child_schema = schema->get_child("additionalProperties");
 			if (child_schema.is_valid()) {
 				auto additional_result = create_rules(child_schema);
 				result.errors.insert(result.errors.end(), additional_result.errors.begin(), additional_result.errors.end());
 
 				if (additional_result.is_valid() && !additional_result.rules->is_empty()) {
-					std::vector<StringName> defined_properties;
-					std::vector<String> pattern_properties_list;
-
-					// Same collection logic as above...
-					if (schema_def.has("properties")) {
-						Dictionary properties = schema_def["properties"].operator Dictionary();
-						Array prop_keys = properties.keys();
-						for (int i = 0; i < prop_keys.size(); i++) {
-							defined_properties.push_back(StringName(prop_keys[i].operator String()));
-						}
-					}
-
-					if (schema_def.has("patternProperties")) {
-						Dictionary pattern_properties = schema_def["patternProperties"].operator Dictionary();
-						Array pattern_keys = pattern_properties.keys();
-						for (int i = 0; i < pattern_keys.size(); i++) {
-							pattern_properties_list.push_back(pattern_keys[i].operator String());
-						}
-					}
-
-					auto selector = std::make_unique<AdditionalPropertiesSelector>(defined_properties, pattern_properties_list);
-					result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(additional_result.rules)));
+					object_rule->set_additional_properties_rule(additional_result.rules);
 				}
 			}
 		}
 	}
 
+	if (!object_rule->is_empty()) {
+		result.rules->add_rule(object_rule);
+	}
+
 	// Dependencies - property and Schema dependencies
 	if (schema_def.has("dependencies")) {
 		Dictionary dependencies = schema_def["dependencies"].operator Dictionary();
@@ -538,9 +673,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 				}
 
 				if (!props.empty()) {
-					auto selector = std::make_unique<ValueSelector>();
-					auto rule = std::make_unique<DependencyRule>(dep_name, props);
-					result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+					result.rules->add_rule(std::make_unique<DependencyRule>(dep_name, props));
 				}
 
 			} else if (dep_value.get_type() == Variant::DICTIONARY) {
@@ -553,9 +686,7 @@ void RuleFactory::create_object_rules(const Dictionary &schema_def, const Ref<Sc
 					result.errors.insert(result.errors.end(), dep_result.errors.begin(), dep_result.errors.end());
 
 					if (dep_result.is_valid() && !dep_result.rules->is_empty()) {
-						auto selector = std::make_unique<ValueSelector>();
-						auto rule = std::make_unique<DependencyRule>(dep_name, dep_result.rules);
-						result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+						result.rules->add_rule(std::make_unique<DependencyRule>(dep_name, dep_result.rules));
 					}
 				}
 			}
@@ -569,9 +700,7 @@ void RuleFactory::create_array_rules(const Dictionary &schema_def, const Ref<Sch
 		Variant min_items_var = schema_def["minItems"];
 		int64_t min_items;
 		if (try_get_non_negative_int(min_items_var, min_items)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MinItemsRule>(min_items);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MinItemsRule>(min_items));
 		}
 	}
 
@@ -580,9 +709,7 @@ void RuleFactory::create_array_rules(const Dictionary &schema_def, const Ref<Sch
 		Variant max_items_var = schema_def["maxItems"];
 		int64_t max_items;
 		if (try_get_non_negative_int(max_items_var, max_items)) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<MaxItemsRule>(max_items);
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<MaxItemsRule>(max_items));
 		}
 	}
 
@@ -590,9 +717,7 @@ void RuleFactory::create_array_rules(const Dictionary &schema_def, const Ref<Sch
 	if (schema_def.has("uniqueItems")) {
 		Variant unique_items_var = schema_def["uniqueItems"];
 		if (unique_items_var.get_type() == Variant::BOOL && unique_items_var.operator bool()) {
-			auto selector = std::make_unique<ValueSelector>();
-			auto rule = std::make_unique<UniqueItemsRule>();
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+			result.rules->add_rule(std::make_unique<UniqueItemsRule>());
 		}
 	}
 
@@ -673,27 +798,19 @@ void RuleFactory::create_array_rules(const Dictionary &schema_def, const Ref<Sch
 			// Check if this is boolean Schema detection
 			if (child_def.is_empty()) {
 				// contains: true (empty Schema) - always matches any item
-				auto selector = std::make_unique<ValueSelector>();
-				auto rule = std::make_shared<TrueRule>();
-				auto contains_rule = std::make_unique<ContainsRule>(rule);
-				result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(contains_rule)));
+				result.rules->add_rule(std::make_unique<ContainsRule>(std::make_shared<TrueRule>()));
 			} else if (child_def.size() == 1 && child_def.has("not") &&
 					child_def["not"].get_type() == Variant::DICTIONARY &&
 					child_def["not"].operator Dictionary().is_empty()) {
 				// contains: false pattern {"not": {}} - never matches any item
-				auto selector = std::make_unique<ValueSelector>();
-				auto rule = std::make_shared<FalseRule>();
-				auto contains_rule = std::make_unique<ContainsRule>(rule);
-				result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(contains_rule)));
+				result.rules->add_rule(std::make_unique<ContainsRule>(std::make_shared<FalseRule>()));
 			} else {
 				// Normal Schema - compile recursively
 				auto contains_result = create_rules(child_schema);
 				result.errors.insert(result.errors.end(), contains_result.errors.begin(), contains_result.errors.end());
 
 				if (contains_result.is_valid()) {
-					auto selector = std::make_unique<ValueSelector>();
-					auto rule = std::make_unique<ContainsRule>(contains_result.rules);
-					result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(rule)));
+					result.rules->add_rule(std::make_unique<ContainsRule>(contains_result.rules));
 				}
 			}
 		}
@@ -722,8 +839,7 @@ void RuleFactory::create_logical_rules(const Dictionary &schema_def, const Ref<S
 				}
 			}
 
-			auto selector = std::make_unique<ValueSelector>();
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(all_of_rule)));
+			result.rules->add_rule(std::move(all_of_rule));
 		}
 	}
 
@@ -748,8 +864,7 @@ void RuleFactory::create_logical_rules(const Dictionary &schema_def, const Ref<S
 				}
 			}
 
-			auto selector = std::make_unique<ValueSelector>();
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(any_of_rule)));
+			result.rules->add_rule(std::move(any_of_rule));
 		}
 	}
 
@@ -774,8 +889,7 @@ void RuleFactory::create_logical_rules(const Dictionary &schema_def, const Ref<S
 				}
 			}
 
-			auto selector = std::make_unique<ValueSelector>();
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(one_of_rule)));
+			result.rules->add_rule(std::move(one_of_rule));
 		}
 	}
 
@@ -790,8 +904,7 @@ void RuleFactory::create_logical_rules(const Dictionary &schema_def, const Ref<S
 
 				if (not_result.is_valid()) {
 					auto not_rule = std::make_unique<NotRule>(std::move(not_result.rules));
-					auto selector = std::make_unique<ValueSelector>();
-					result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(not_rule)));
+					result.rules->add_rule(std::move(not_rule));
 				}
 			}
 		}
@@ -844,8 +957,7 @@ void RuleFactory::create_logical_rules(const Dictionary &schema_def, const Ref<S
 		// Create the conditional rule if we have at least an 'if' rule
 		if (if_rule) {
 			auto conditional_rule = std::make_unique<ConditionalRule>(if_rule, then_rule, else_rule);
-			auto selector = std::make_unique<ValueSelector>();
-			result.rules->add_rule(std::make_unique<SelectorRule>(std::move(selector), std::move(conditional_rule)));
+			result.rules->add_rule(std::move(conditional_rule));
 		}
 	}
 }
@@ -9,7 +9,9 @@
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include <atomic>
 #include <functional>
+#include <list>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -18,6 +20,7 @@
 namespace godot {
 
 // Forward declarations
+class RefRule;
 class Schema;
 
 /**
@@ -55,14 +58,75 @@ public:
 
 private:
 	/**
-	 * @brief Cache of compiled rules for reuse indexed by Dictionary.hash()
+	 * @struct InternedRules
+	 * @brief Compiled rules shared by every Schema with an equal definition in the same scope
 	 */
-	std::unordered_map<uint64_t, std::shared_ptr<RuleGroup>> rule_cache;
+	struct InternedRules {
+		uint64_t content_hash;
+		Dictionary definition; // Compared on lookup, content hashes can collide
+		uint64_t scope; // See get_intern_scope()
+		std::shared_ptr<RuleGroup> rules;
+		size_t bytes; // Estimated memory, see estimate_memory_usage()
+	};
+
+	/**
+	 * @brief Interned compiled rules, most recently used first
+	 */
+	std::list<InternedRules> rule_cache;
+
+	/**
+	 * @brief Entries of rule_cache indexed by Schema::get_content_hash()
+	 */
+	std::unordered_map<uint64_t, std::vector<std::list<InternedRules>::iterator>> rule_cache_index;
+
+	// Bounds and counters of rule_cache, guarded by cache_mutex
+	int64_t cache_capacity = DEFAULT_CACHE_CAPACITY;
+	int64_t cache_max_bytes = 0; // 0 for unlimited
+	size_t cache_bytes = 0;
+	uint64_t cache_hits = 0;
+	uint64_t cache_misses = 0;
+	uint64_t cache_evictions = 0;
+
+	/**
+	 * @brief Schemas being compiled by the current thread, used to break $ref cycles
+	 *
+	 * Thread-local so a Schema compiled concurrently by another thread (e.g. a
+	 * $ref target reached from parallel batch validation) is not mistaken for a cycle.
+	 */
+	static thread_local std::unordered_set<const Schema *> compiling_schemas;
+
+	/**
+	 * @struct PendingRef
+	 * @brief A $ref created by the current compilation, linked once it finishes
+	 */
+	struct PendingRef {
+		std::shared_ptr<RuleGroup> rules; // Keeps the rule alive until linked
+		const RefRule *rule;
+	};
 
 	/**
-	 * @brief Currently compiling schemas list
+	 * @brief References awaiting the link pass of the current thread's outermost compilation
 	 */
-	std::unordered_set<uint64_t> compiling_schemas;
+	static thread_local std::vector<PendingRef> pending_refs;
+
+	/**
+	 * @brief Nesting depth of create_rules() on the current thread
+	 */
+	static thread_local int compile_depth;
+
+	/**
+	 * @struct ParallelCompileState
+	 * @brief Sub-schemas compiled by compile_subschemas_parallel() and the references they queued
+	 */
+	struct ParallelCompileState {
+		std::vector<Ref<Schema>> schemas;
+		std::vector<std::vector<PendingRef>> pending_refs; // Per schema, linked by the calling thread
+	};
+
+	/**
+	 * @brief Minimum number of sub-schemas under a root compiled in parallel, 0 to disable
+	 */
+	std::atomic<int64_t> parallel_compile_threshold{ 0 };
 
 	/**
 	 * @brief Mutex for thread-safe cache access
@@ -83,6 +147,11 @@ private:
 	void operator=(RuleFactory const &); // Don't implement
 
 public:
+	/**
+	 * @brief Default maximum number of interned rule groups
+	 */
+	static constexpr int64_t DEFAULT_CACHE_CAPACITY = 4096;
+
 	/**
 	 * @brief Singleton instance
 	 */
@@ -107,7 +176,137 @@ public:
 		custom_rule_factories[keyword] = factory;
 	}
 
+	/**
+	 * @brief Sets the maximum number of interned rule groups
+	 * @param capacity Maximum entries, 0 disables interning
+	 */
+	void set_cache_capacity(int64_t capacity);
+
+	/**
+	 * @brief Gets the maximum number of interned rule groups
+	 * @return Maximum entries
+	 */
+	int64_t get_cache_capacity();
+
+	/**
+	 * @brief Sets the maximum estimated memory of the interned rule groups
+	 * @param max_bytes Maximum bytes, 0 for unlimited
+	 */
+	void set_cache_max_bytes(int64_t max_bytes);
+
+	/**
+	 * @brief Gets the maximum estimated memory of the interned rule groups
+	 * @return Maximum bytes, 0 for unlimited
+	 */
+	int64_t get_cache_max_bytes();
+
+	/**
+	 * @brief Sets the minimum number of sub-schemas under a root Schema compiled on worker threads
+	 * @param threshold Minimum sub-schema count, 0 to compile on the calling thread only
+	 */
+	void set_parallel_compile_threshold(int64_t threshold) { parallel_compile_threshold.store(threshold, std::memory_order_relaxed); }
+
+	/**
+	 * @brief Gets the minimum number of sub-schemas under a root Schema compiled on worker threads
+	 * @return Minimum sub-schema count, 0 if disabled
+	 */
+	int64_t get_parallel_compile_threshold() const { return parallel_compile_threshold.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Removes every interned rule group, compiled schemas keep their rules
+	 */
+	void clear_cache();
+
+	/**
+	 * @brief Gets the counters of the interned rule groups
+	 * @return Dictionary with "entries", "bytes", "hits", "misses" and "evictions"
+	 */
+	Dictionary get_cache_stats();
+
 private:
+	/**
+	 * @brief Gets the scope in which the compiled rules of a Schema may be shared
+	 * @param schema The Schema
+	 * @return 0 if the rules can be shared across documents, otherwise the instance ID of the Schema's root
+	 *
+	 * $ref rules resolve against, and point into, the document they were
+	 * compiled from, so equal subschemas containing a $ref are only shared
+	 * within one document.
+	 */
+	static uint64_t get_intern_scope(const Ref<Schema> &schema);
+
+	/**
+	 * @brief Looks up interned rules equal to a Schema's definition
+	 * @param schema The Schema
+	 * @return The rules, or null if none are interned
+	 */
+	std::shared_ptr<RuleGroup> find_interned_rules(const Ref<Schema> &schema);
+
+	/**
+	 * @brief Interns the compiled rules of a Schema, unless equal rules were interned meanwhile
+	 * @param schema The Schema
+	 * @param rules Its compiled rules
+	 */
+	void intern_rules(const Ref<Schema> &schema, const std::shared_ptr<RuleGroup> &rules);
+
+	/**
+	 * @brief Evicts the least recently used entries until the cache is within its bounds, cache_mutex must be locked
+	 */
+	void evict_interned_rules();
+
+	/**
+	 * @brief Estimated memory of one interned rule group
+	 * @param rules The rule group
+	 * @return Approximate size in bytes
+	 *
+	 * Sub-schemas are interned separately, so only the group's own rules count.
+	 */
+	static size_t estimate_memory_usage(const RuleGroup &rules);
+
+	/**
+	 * @brief Approximate size of one compiled rule, including its allocations
+	 */
+	static constexpr size_t ESTIMATED_RULE_BYTES = 128;
+
+	/**
+	 * @brief Compiles a single Schema, create_rules() wraps it with the link pass
+	 * @param schema The Schema to create rules for
+	 * @return Compile result with rules and any errors
+	 */
+	RuleCompileResult compile_schema(const Ref<Schema> &schema);
+
+	/**
+	 * @brief Compiles the direct sub-schemas of a root Schema on worker threads
+	 * @param schema The root Schema about to be compiled
+	 *
+	 * Does nothing below the parallel compile threshold, or inside one of the
+	 * extension's WorkerThreadPool tasks (SchemaUtil::PoolTaskScope), whose
+	 * worker would block waiting for the group; the sub-schemas then compile
+	 * serially. Each sub-schema
+	 * subtree compiles independently, with the cycle guard of its worker
+	 * thread. References are not linked by the workers, since targets such
+	 * as "#" would compile the whole document there. They are queued for the
+	 * link pass of the calling thread's compilation instead, which then finds
+	 * the sub-schemas compiled.
+	 */
+	void compile_subschemas_parallel(const Ref<Schema> &schema);
+
+	/**
+	 * @brief WorkerThreadPool task compiling one sub-schema of a ParallelCompileState
+	 * @param userdata The ParallelCompileState
+	 * @param index Index of the sub-schema
+	 */
+	static void compile_subschema_task(void *userdata, uint32_t index);
+
+	/**
+	 * @brief Links the references queued by the finished compilation
+	 *
+	 * Runs once the outermost compilation has published its rules, so
+	 * references back into schemas that were still compiling (cycles such as
+	 * "#") link to their final rules.
+	 */
+	void link_pending_refs();
+
 	/**
 	 * @brief Creates $ref validation rules
 	 * @param ref_def The reference definition
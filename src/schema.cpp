@@ -1,12 +1,19 @@
 #include "schema.hpp"
+#include "compiled_schema_file.hpp"
+#include "content_hash.hpp"
 #include "rule_factory.hpp"
 #include "schema_registry.hpp"
+#include "util.hpp"
 
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include <algorithm>
+
 using namespace godot;
 
 void Schema::_bind_methods() {
@@ -44,8 +51,32 @@ void Schema::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("is_valid"), &Schema::is_valid);
 	ClassDB::bind_method(D_METHOD("validate", "data"), &Schema::validate);
+	ClassDB::bind_method(D_METHOD("validate_into", "data", "result"), &Schema::validate_into);
+	ClassDB::bind_method(D_METHOD("is_data_valid", "data"), &Schema::is_data_valid);
+	ClassDB::bind_method(D_METHOD("validate_batch", "documents"), &Schema::validate_batch);
+	ClassDB::bind_method(D_METHOD("validate_batch_parallel", "documents"), &Schema::validate_batch_parallel);
+	ClassDB::bind_method(D_METHOD("validate_patch", "data", "previous", "changed_paths"), &Schema::validate_patch);
+	ClassDB::bind_method(D_METHOD("set_use_rule_program", "enabled"), &Schema::set_use_rule_program);
+	ClassDB::bind_method(D_METHOD("is_using_rule_program"), &Schema::is_using_rule_program);
+	ClassDB::bind_method(D_METHOD("set_use_validation_memo", "enabled"), &Schema::set_use_validation_memo);
+	ClassDB::bind_method(D_METHOD("is_using_validation_memo"), &Schema::is_using_validation_memo);
+	ClassDB::bind_method(D_METHOD("set_max_errors", "max_errors"), &Schema::set_max_errors);
+	ClassDB::bind_method(D_METHOD("get_max_errors"), &Schema::get_max_errors);
+	ClassDB::bind_method(D_METHOD("set_max_errors_per_subtree", "max_errors"), &Schema::set_max_errors_per_subtree);
+	ClassDB::bind_method(D_METHOD("get_max_errors_per_subtree"), &Schema::get_max_errors_per_subtree);
+	ClassDB::bind_method(D_METHOD("set_parallel_items_threshold", "threshold"), &Schema::set_parallel_items_threshold);
+	ClassDB::bind_method(D_METHOD("get_parallel_items_threshold"), &Schema::get_parallel_items_threshold);
+	ClassDB::bind_method(D_METHOD("set_max_depth", "max_depth"), &Schema::set_max_depth);
+	ClassDB::bind_method(D_METHOD("get_max_depth"), &Schema::get_max_depth);
+	ClassDB::bind_method(D_METHOD("set_result_cache_capacity", "capacity"), &Schema::set_result_cache_capacity);
+	ClassDB::bind_method(D_METHOD("get_result_cache_capacity"), &Schema::get_result_cache_capacity);
+	ClassDB::bind_method(D_METHOD("set_result_cache_max_bytes", "max_bytes"), &Schema::set_result_cache_max_bytes);
+	ClassDB::bind_method(D_METHOD("get_result_cache_max_bytes"), &Schema::get_result_cache_max_bytes);
+	ClassDB::bind_method(D_METHOD("clear_result_cache"), &Schema::clear_result_cache);
+	ClassDB::bind_method(D_METHOD("get_result_cache_stats"), &Schema::get_result_cache_stats);
 	ClassDB::bind_method(D_METHOD("get_compile_errors"), &Schema::get_compile_errors);
 	ClassDB::bind_method(D_METHOD("get_compile_error_summary"), &Schema::get_compile_error_summary);
+	ClassDB::bind_method(D_METHOD("save_to_compiled_file", "path", "source_json_path"), &Schema::save_to_compiled_file, DEFVAL(""));
 
 	ClassDB::bind_static_method("Schema", D_METHOD("build_schema", "schema_dict", "validate_against_meta"), &Schema::build_schema, DEFVAL(false));
 	ClassDB::bind_static_method("Schema", D_METHOD("register_schema", "schema", "id"), &Schema::register_schema, DEFVAL(""));
@@ -54,6 +85,15 @@ void Schema::_bind_methods() {
 	ClassDB::bind_static_method("Schema", D_METHOD("unregister_schema", "id"), &Schema::unregister_schema);
 	ClassDB::bind_static_method("Schema", D_METHOD("load_from_json", "json_string", "validate_against_meta"), &Schema::load_from_json, DEFVAL(false));
 	ClassDB::bind_static_method("Schema", D_METHOD("load_from_json_file", "path", "validate_against_meta"), &Schema::load_from_json_file, DEFVAL(false));
+	ClassDB::bind_static_method("Schema", D_METHOD("load_from_compiled_file", "path", "fallback_json_path", "validate_against_meta"), &Schema::load_from_compiled_file, DEFVAL(""), DEFVAL(false));
+	ClassDB::bind_static_method("Schema", D_METHOD("set_rule_cache_capacity", "capacity"), &Schema::set_rule_cache_capacity);
+	ClassDB::bind_static_method("Schema", D_METHOD("get_rule_cache_capacity"), &Schema::get_rule_cache_capacity);
+	ClassDB::bind_static_method("Schema", D_METHOD("set_rule_cache_max_bytes", "max_bytes"), &Schema::set_rule_cache_max_bytes);
+	ClassDB::bind_static_method("Schema", D_METHOD("get_rule_cache_max_bytes"), &Schema::get_rule_cache_max_bytes);
+	ClassDB::bind_static_method("Schema", D_METHOD("clear_rule_cache"), &Schema::clear_rule_cache);
+	ClassDB::bind_static_method("Schema", D_METHOD("get_rule_cache_stats"), &Schema::get_rule_cache_stats);
+	ClassDB::bind_static_method("Schema", D_METHOD("set_parallel_compile_threshold", "threshold"), &Schema::set_parallel_compile_threshold);
+	ClassDB::bind_static_method("Schema", D_METHOD("get_parallel_compile_threshold"), &Schema::get_parallel_compile_threshold);
 
 	BIND_VIRTUAL_METHOD(Schema, _to_string);
 }
@@ -61,21 +101,17 @@ void Schema::_bind_methods() {
 Schema::Schema() {
 	schema_type = SchemaType::SCHEMA_OBJECT; // Default for empty root
 	schema_path = ""; // Root has empty path
-	is_compiled = false;
-	compilation_mutex = Ref<Mutex>(memnew(Mutex));
 }
 
 Schema::Schema(const Dictionary &schema_dict, const Ref<Schema> &p_root_schema, const StringName &p_schema_path, const bool validate_against_meta) {
 	schema_type = SchemaType::SCHEMA_OBJECT;
 	schema_path = "";
-	is_compiled = false;
-	compilation_mutex = Ref<Mutex>(memnew(Mutex));
 
 	if (validate_against_meta) {
 		Ref<Schema> meta_schema = SchemaRegistry::get_singleton().get_schema("http://json-schema.org/draft-07/schema#");
 		if (meta_schema.is_null()) {
 			UtilityFunctions::push_error("Meta-schema \"http://json-schema.org/draft-07/schema#\" not registered; cannot validate schema definition");
-			is_compiled = true;
+			set_compilation_result(nullptr, {});
 			return; // Don't construct children or attempt compilation
 		}
 
@@ -83,13 +119,14 @@ Schema::Schema(const Dictionary &schema_dict, const Ref<Schema> &p_root_schema,
 
 		if (validation_result->has_errors()) {
 			// Convert meta-validation errors to compilation errors
+			std::vector<SchemaCompileError> meta_errors;
 			for (int i = 0; i < validation_result->error_count(); i++) {
 				String message = validation_result->get_error_message(i);
 				PackedStringArray path_parts = validation_result->get_error_path_array(i);
-				compile_errors.emplace_back(vformat("Meta-schema validation failed: %s", message), path_parts);
+				meta_errors.emplace_back(vformat("Meta-schema validation failed: %s", message), path_parts);
 			}
 
-			is_compiled = true;
+			set_compilation_result(nullptr, std::move(meta_errors));
 			return; // Don't construct children or attempt compilation
 		}
 	}
@@ -123,17 +160,37 @@ Schema::Schema(const Dictionary &schema_dict, const Ref<Schema> &p_root_schema,
 	}
 
 	construct_children(schema_dict);
+	compute_content_hash();
+}
+
+void Schema::compute_content_hash() {
+	// Children hashed their own definitions, only the rest of this node is visited
+	std::unordered_map<uintptr_t, uint64_t> child_hashes;
+	references = schema_definition.has("$ref");
+	for (const auto &child : children) {
+		child_hashes[SchemaUtil::get_container_id(child.second->schema_definition)] = child.second->content_hash;
+		references = references || child.second->references;
+	}
+
+	if (!ContentHash::hash64(schema_definition, child_hashes, content_hash)) {
+		content_hash = schema_definition.hash(); // Contains Objects or math types
+	}
 }
 
 Schema::~Schema() {
 	// Children and items will be automatically freed by Ref<> destructors
 	root_schema.unref();
+	delete compiled_state.load(std::memory_order_acquire);
 }
 
 Ref<Schema> Schema::build_schema(const Dictionary &schema_dict, bool validate_against_meta) {
-	Ref<Schema> schema = memnew(Schema(schema_dict, nullptr, "", validate_against_meta));
+	return finish_build(memnew(Schema(schema_dict, nullptr, "", validate_against_meta)));
+}
+
+Ref<Schema> Schema::finish_build(const Ref<Schema> &schema) {
 	schema->compile();
-	if (schema->compile_errors.size() > 0) {
+	const CompiledState *state = schema->get_compiled_state();
+	if (state && !state->errors.empty()) {
 		UtilityFunctions::push_error("Building schema failed failed:\n", schema->get_compile_error_summary());
 	}
 
@@ -214,14 +271,123 @@ Ref<Schema> Schema::load_from_json(const String &json_string, bool validate_agai
 	return build_schema(result.operator Dictionary(), validate_against_meta);
 }
 
+Ref<Schema> Schema::load_from_compiled_file(const String &path, const String &fallback_json_path, bool validate_against_meta) {
+	Dictionary definition;
+	uint64_t source_hash = 0;
+	uint32_t flags = 0;
+	Error err = CompiledSchemaFile::read(path, definition, source_hash, flags);
+
+	if (err == OK && source_hash != 0 && !fallback_json_path.is_empty()) {
+		// Exports may not ship the JSON source, the compiled file is used then
+		uint64_t current_hash = 0;
+		if (CompiledSchemaFile::hash_source(fallback_json_path, current_hash) == OK && current_hash != source_hash) {
+			UtilityFunctions::push_warning(vformat("Compiled Schema file %s is out of date, loading %s instead", path, fallback_json_path));
+			return load_from_json_file(fallback_json_path, validate_against_meta);
+		}
+	}
+
+	if (err == OK) {
+		const bool meta_valid = (flags & CompiledSchemaFile::FLAG_META_VALID) != 0;
+		if (validate_against_meta && !meta_valid) {
+			// Rare, the file was written without a registered meta-schema
+			return build_schema(definition, true);
+		}
+
+		return finish_build(memnew(Schema(definition, nullptr, "", false)));
+	}
+
+	if (fallback_json_path.is_empty()) {
+		UtilityFunctions::push_error(vformat("Failed to load compiled Schema file: %s (%s)", path, UtilityFunctions::error_string(err)));
+		return Ref<Schema>();
+	}
+	if (err != ERR_FILE_NOT_FOUND) {
+		UtilityFunctions::push_warning(vformat("Compiled Schema file %s was rejected (%s), loading %s instead", path, UtilityFunctions::error_string(err), fallback_json_path));
+	}
+	return load_from_json_file(fallback_json_path, validate_against_meta);
+}
+
+Error Schema::save_to_compiled_file(const String &path, const String &source_json_path) const {
+	if (!is_root()) {
+		UtilityFunctions::push_error("Only root Schemas can be saved to a compiled file");
+		return ERR_INVALID_PARAMETER;
+	}
+	const CompiledState *state = get_compiled_state();
+	if (!state || !state->errors.empty()) {
+		UtilityFunctions::push_error("Cannot save a Schema with compile errors to a compiled file");
+		return ERR_INVALID_DATA;
+	}
+
+	uint64_t source_hash = 0;
+	if (!source_json_path.is_empty()) {
+		const Error source_err = CompiledSchemaFile::hash_source(source_json_path, source_hash);
+		if (source_err != OK) {
+			UtilityFunctions::push_error(vformat("Failed to read JSON Schema source: %s (%s)", source_json_path, UtilityFunctions::error_string(source_err)));
+			return source_err;
+		}
+	}
+
+	// Meta-schema validation is paid here once instead of on every load
+	uint32_t flags = 0;
+	Ref<Schema> meta_schema = SchemaRegistry::get_singleton().get_schema("http://json-schema.org/draft-07/schema#");
+	if (meta_schema.is_valid() && meta_schema->validate(schema_definition)->is_valid()) {
+		flags |= CompiledSchemaFile::FLAG_META_VALID;
+	}
+
+	const Error err = CompiledSchemaFile::write(path, schema_definition, source_hash, flags);
+	if (err != OK) {
+		UtilityFunctions::push_error(vformat("Failed to write compiled Schema file: %s (%s)", path, UtilityFunctions::error_string(err)));
+	}
+	return err;
+}
+
+void Schema::set_rule_cache_capacity(int64_t capacity) {
+	if (capacity < 0) {
+		UtilityFunctions::push_error("rule_cache_capacity must not be negative");
+		return;
+	}
+	RuleFactory::get_singleton().set_cache_capacity(capacity);
+}
+
+int64_t Schema::get_rule_cache_capacity() {
+	return RuleFactory::get_singleton().get_cache_capacity();
+}
+
+void Schema::set_rule_cache_max_bytes(int64_t max_bytes) {
+	if (max_bytes < 0) {
+		UtilityFunctions::push_error("rule_cache_max_bytes must not be negative");
+		return;
+	}
+	RuleFactory::get_singleton().set_cache_max_bytes(max_bytes);
+}
+
+int64_t Schema::get_rule_cache_max_bytes() {
+	return RuleFactory::get_singleton().get_cache_max_bytes();
+}
+
+void Schema::clear_rule_cache() {
+	RuleFactory::get_singleton().clear_cache();
+}
+
+Dictionary Schema::get_rule_cache_stats() {
+	return RuleFactory::get_singleton().get_cache_stats();
+}
+
+void Schema::set_parallel_compile_threshold(int64_t threshold) {
+	if (threshold < 0) {
+		UtilityFunctions::push_error("parallel_compile_threshold must not be negative");
+		return;
+	}
+	RuleFactory::get_singleton().set_parallel_compile_threshold(threshold);
+}
+
+int64_t Schema::get_parallel_compile_threshold() {
+	return RuleFactory::get_singleton().get_parallel_compile_threshold();
+}
+
 void Schema::compile() {
-	// Check if compilation is needed
-	compilation_mutex->lock();
-	if (is_compiled) {
-		compilation_mutex->unlock();
+	if (get_compiled_state()) {
 		return; // Already compiled
 	}
-	compilation_mutex->unlock();
 
 	// Let RuleFactory handle the compilation
 	Ref<Schema> ref = (const_cast<Schema *>(this));
@@ -328,10 +494,6 @@ Variant Schema::variant_to_schema_dict(const Variant &value) const {
 	}
 }
 
-void Schema::add_compile_error(const String error_message) {
-	compile_errors.push_back(SchemaCompileError(error_message, PackedStringArray(schema_path.split("/"))));
-}
-
 void Schema::construct_children(const Dictionary &dict) {
 	// ========== OBJECT SCHEMAS ==========
 	if (schema_type == SchemaType::SCHEMA_OBJECT) {
@@ -709,72 +871,389 @@ Ref<Schema> Schema::get_at_path(const StringName &path) const {
 	return current;
 }
 
+const Schema::CompiledState *Schema::ensure_compiled() {
+	const CompiledState *state = get_compiled_state();
+	if (!state) {
+		compile();
+		state = get_compiled_state();
+	}
+	return state;
+}
+
+std::shared_ptr<RuleProgram> Schema::CompiledState::get_program() const {
+	std::call_once(program_flag, [this]() {
+		if (rules) {
+			program = RuleProgram::lower(rules);
+		}
+	});
+	return program;
+}
+
+bool Schema::prepare_validation(std::shared_ptr<RuleGroup> &out_rules, std::shared_ptr<RuleProgram> &out_program, ValidationContext &context) {
+	// After the first compilation this only performs atomic loads
+	const CompiledState *state = ensure_compiled();
+
+	if (state && !state->errors.empty()) {
+		for (const SchemaCompileError &error : state->errors) {
+			context.add_error(error.message, error.get_path_string());
+		}
+		return false;
+	}
+
+	if (!state || !state->rules) {
+		context.add_error("Schema not compiled");
+		return false;
+	}
+
+	out_rules = state->rules;
+	const int64_t subtree_limit = max_errors_per_subtree.load(std::memory_order_relaxed);
+	context.set_error_limits(max_errors.load(std::memory_order_relaxed), subtree_limit);
+	// The program unwinds to the innermost combinator on a stop, it cannot resume with a sibling subtree
+	const bool walk_subtrees = subtree_limit > 0 && context.is_collecting_errors();
+	out_program = use_rule_program.load(std::memory_order_relaxed) && !walk_subtrees ? state->get_program() : nullptr;
+	context.set_parallel_items_threshold(parallel_items_threshold.load(std::memory_order_relaxed));
+	context.set_max_depth(max_depth.load(std::memory_order_relaxed));
+	context.set_memoize(use_validation_memo.load(std::memory_order_relaxed));
+	return true;
+}
+
 Ref<SchemaValidationResult> Schema::validate(const Variant &data) {
-	// Check compilation status safely
-	compilation_mutex->lock();
-	bool needs_compilation = !is_compiled;
-	compilation_mutex->unlock();
+	ValidationContext context(this);
+	std::shared_ptr<RuleGroup> validation_rules;
+	std::shared_ptr<RuleProgram> validation_program;
 
-	// Ensure compilation is complete
-	if (needs_compilation) {
-		compile();
+	if (!prepare_validation(validation_rules, validation_program, context)) {
+		return SchemaValidationResult::from_context(context);
 	}
 
-	// Lock for reading compilation state
-	compilation_mutex->lock();
+	uint64_t content_hash = 0;
+	uint64_t cache_generation = 0;
+	const bool cacheable = result_cache.is_enabled() && ContentHash::hash64(data, content_hash);
+	if (cacheable) {
+		Ref<SchemaValidationResult> cached = result_cache.lookup(content_hash, cache_generation);
+		if (cached.is_valid()) {
+			return cached;
+		}
+	}
+
+	if (validation_program) {
+		validation_program->execute(data, context);
+	} else {
+		validation_rules->validate(data, context);
+	}
+
+	Ref<SchemaValidationResult> result = SchemaValidationResult::from_context(context);
+	if (cacheable) {
+		result_cache.insert(content_hash, cache_generation, result);
+	}
+	return result;
+}
+
+bool Schema::validate_into(const Variant &data, const Ref<SchemaValidationResult> &result) {
+	if (result.is_null()) {
+		UtilityFunctions::push_error("validate_into() requires a result");
+		return false;
+	}
+	if (result->is_shared()) {
+		UtilityFunctions::push_error("validate_into() cannot modify a shared result, pass one created with SchemaValidationResult.new()");
+		return false;
+	}
 
 	ValidationContext context(this);
+	std::shared_ptr<RuleGroup> validation_rules;
+	std::shared_ptr<RuleProgram> validation_program;
 
-	if (!is_valid()) {
-		for (auto error : compile_errors) {
-			context.add_error(error.message, error.get_path_string());
+	if (!prepare_validation(validation_rules, validation_program, context)) {
+		result->assign_from_context(context);
+		return false;
+	}
+
+	uint64_t content_hash = 0;
+	uint64_t cache_generation = 0;
+	const bool cacheable = result_cache.is_enabled() && ContentHash::hash64(data, content_hash);
+	if (cacheable) {
+		Ref<SchemaValidationResult> cached = result_cache.lookup(content_hash, cache_generation);
+		if (cached.is_valid()) {
+			result->assign(*cached.ptr());
+			return result->is_valid();
+		}
+	}
+
+	const bool valid = validation_program ? validation_program->execute(data, context) : validation_rules->validate(data, context);
+
+	result->assign_from_context(context);
+	if (cacheable) {
+		// The caller keeps modifying its result, the cache needs its own
+		Ref<SchemaValidationResult> cached = SchemaValidationResult::success();
+		if (!valid) {
+			cached = Ref<SchemaValidationResult>(memnew(SchemaValidationResult));
+			cached->assign(*result.ptr());
 		}
-		compilation_mutex->unlock();
+		result_cache.insert(content_hash, cache_generation, cached);
+	}
+	return valid;
+}
+
+bool Schema::is_data_valid(const Variant &data) {
+	ValidationContext context(this, false);
+	std::shared_ptr<RuleGroup> validation_rules;
+	std::shared_ptr<RuleProgram> validation_program;
+
+	if (!prepare_validation(validation_rules, validation_program, context)) {
+		return false;
+	}
+
+	uint64_t content_hash = 0;
+	uint64_t cache_generation = 0;
+	const bool cacheable = result_cache.is_enabled() && ContentHash::hash64(data, content_hash);
+	if (cacheable) {
+		Ref<SchemaValidationResult> cached = result_cache.lookup(content_hash, cache_generation);
+		if (cached.is_valid()) {
+			return cached->is_valid();
+		}
+	}
+
+	const bool valid = validation_program ? validation_program->execute(data, context) : validation_rules->validate(data, context);
+
+	// Failing runs stop early without errors, only successes are complete results
+	if (cacheable && valid) {
+		result_cache.insert(content_hash, cache_generation, SchemaValidationResult::success());
+	}
+	return valid;
+}
+
+/**
+ * @brief Shared state of a batch validation, each shard writes a disjoint index range
+ */
+struct BatchValidationState {
+	const Array *documents = nullptr;
+	const RuleGroup *rules = nullptr;
+	const RuleProgram *program = nullptr;
+	const ValidationContext *prototype = nullptr; // Prepared context copied by every shard
+	int64_t count = 0;
+	int64_t shard_size = 0;
+	std::vector<uint8_t> valid_flags;
+	std::vector<Ref<SchemaValidationResult>> failures;
+};
+
+static void validate_batch_range(BatchValidationState &state, int64_t begin, int64_t end) {
+	// One context per range, reset between documents to reuse its storage
+	ValidationContext context(*state.prototype);
+	for (int64_t i = begin; i < end; i++) {
+		context.reset();
+		const Variant &document = (*state.documents)[i];
+		const bool valid = state.program ? state.program->execute(document, context) : state.rules->validate(document, context);
+
+		state.valid_flags[i] = valid ? 1 : 0;
+		if (!valid) {
+			state.failures[i] = SchemaValidationResult::from_context(context);
+		}
+	}
+}
+
+static void validate_batch_shard(void *userdata, uint32_t shard) {
+	SchemaUtil::PoolTaskScope pool_task;
+	BatchValidationState &state = *static_cast<BatchValidationState *>(userdata);
+	const int64_t begin = static_cast<int64_t>(shard) * state.shard_size;
+	validate_batch_range(state, begin, std::min(begin + state.shard_size, state.count));
+}
+
+Dictionary Schema::run_batch_validation(const Array &documents, bool parallel) {
+	BatchValidationState state;
+	state.documents = &documents;
+	state.count = documents.size();
+	state.valid_flags.resize(state.count, 0);
+	state.failures.resize(state.count);
+
+	ValidationContext prototype(this);
+	std::shared_ptr<RuleGroup> validation_rules;
+	std::shared_ptr<RuleProgram> validation_program;
+
+	if (!prepare_validation(validation_rules, validation_program, prototype)) {
+		// Every document fails with the same compile errors
+		Ref<SchemaValidationResult> compile_result = SchemaValidationResult::from_context(prototype);
+		for (int64_t i = 0; i < state.count; i++) {
+			state.failures[i] = compile_result;
+		}
+	} else {
+		state.rules = validation_rules.get();
+		state.program = validation_program.get();
+		state.prototype = &prototype;
+
+		// Shards are contiguous ranges, a few per core to balance uneven documents
+		const int64_t target_shards = parallel ? OS::get_singleton()->get_processor_count() * 4 : 1;
+		state.shard_size = std::max<int64_t>((state.count + target_shards - 1) / target_shards, MIN_BATCH_SHARD_SIZE);
+		const int64_t shard_count = (state.count + state.shard_size - 1) / state.shard_size;
+
+		if (shard_count > 1) {
+			// Documents are already spread over the workers, don't split their arrays again
+			prototype.set_parallel_items_threshold(0);
+
+			WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+			const int64_t group_id = pool->add_native_group_task(&validate_batch_shard, &state, static_cast<int>(shard_count), -1, true, "Schema batch validation");
+			pool->wait_for_group_task_completion(group_id);
+		} else {
+			validate_batch_range(state, 0, state.count);
+		}
+	}
+
+	// Merge in document order so the result does not depend on scheduling
+	PackedByteArray valid_flags;
+	valid_flags.resize(state.count);
+	Dictionary failures;
+	for (int64_t i = 0; i < state.count; i++) {
+		valid_flags[i] = state.valid_flags[i];
+		if (state.failures[i].is_valid()) {
+			failures[i] = state.failures[i];
+		}
+	}
+
+	Dictionary batch_result;
+	batch_result["valid"] = valid_flags;
+	batch_result["errors"] = failures;
+	return batch_result;
+}
+
+Dictionary Schema::validate_batch(const Array &documents) {
+	return run_batch_validation(documents, false);
+}
+
+Dictionary Schema::validate_batch_parallel(const Array &documents) {
+	return run_batch_validation(documents, true);
+}
+
+Ref<SchemaValidationResult> Schema::validate_patch(const Variant &data, const Ref<SchemaValidationResult> &previous, const PackedStringArray &changed_paths) {
+	ValidationContext context(this);
+	std::shared_ptr<RuleGroup> validation_rules;
+	std::shared_ptr<RuleProgram> validation_program;
+
+	if (!prepare_validation(validation_rules, validation_program, context)) {
 		return SchemaValidationResult::from_context(context);
 	}
 
-	if (!rules) {
-		context.add_error("Schema not compiled");
-		compilation_mutex->unlock();
+	// Truncated errors cannot be replayed, error limits always validate the whole document
+	if (context.has_error_limits()) {
+		validation_rules->validate(data, context);
 		return SchemaValidationResult::from_context(context);
 	}
 
-	auto validation_rules = rules;
-	compilation_mutex->unlock();
+	std::shared_ptr<ValidationSnapshot> snapshot = previous.is_valid() ? previous->take_snapshot() : nullptr;
+	if (snapshot && snapshot->is_compatible(validation_rules, data)) {
+		for (int64_t i = 0; i < changed_paths.size(); i++) {
+			snapshot->invalidate(data, parse_json_pointer(changed_paths[i]));
+		}
+	} else {
+		snapshot = std::make_shared<ValidationSnapshot>(validation_rules, data);
+	}
 
+	// Results are recorded by the tree walker, on the calling thread
+	context.set_snapshot(snapshot.get());
+	context.set_parallel_items_threshold(0);
 	validation_rules->validate(data, context);
-	return SchemaValidationResult::from_context(context);
+	snapshot->prune();
+
+	// The snapshot makes the result unique, never the shared success result
+	Ref<SchemaValidationResult> result = memnew(SchemaValidationResult);
+	result->assign_from_context(context);
+	result->set_snapshot(std::move(snapshot));
+	return result;
+}
+
+void Schema::set_use_rule_program(bool enabled) {
+	use_rule_program.store(enabled, std::memory_order_relaxed);
+}
+
+void Schema::set_use_validation_memo(bool enabled) {
+	use_validation_memo.store(enabled, std::memory_order_relaxed);
+	result_cache.clear(); // Cyclic data validates differently
+}
+
+void Schema::set_max_errors(int64_t p_max_errors) {
+	if (p_max_errors < 0) {
+		UtilityFunctions::push_error("max_errors must not be negative");
+		return;
+	}
+	max_errors.store(p_max_errors, std::memory_order_relaxed);
+	result_cache.clear();
+}
+
+void Schema::set_max_errors_per_subtree(int64_t p_max_errors) {
+	if (p_max_errors < 0) {
+		UtilityFunctions::push_error("max_errors_per_subtree must not be negative");
+		return;
+	}
+	max_errors_per_subtree.store(p_max_errors, std::memory_order_relaxed);
+	result_cache.clear();
+}
+
+void Schema::set_parallel_items_threshold(int64_t threshold) {
+	if (threshold < 0) {
+		UtilityFunctions::push_error("parallel_items_threshold must not be negative");
+		return;
+	}
+	parallel_items_threshold.store(threshold, std::memory_order_relaxed);
+}
+
+void Schema::set_max_depth(int64_t p_max_depth) {
+	if (p_max_depth < 1) {
+		UtilityFunctions::push_error("max_depth must be at least 1");
+		return;
+	}
+	max_depth.store(p_max_depth, std::memory_order_relaxed);
+	result_cache.clear();
+}
+
+void Schema::set_result_cache_capacity(int64_t capacity) {
+	if (capacity < 0) {
+		UtilityFunctions::push_error("result_cache_capacity must not be negative");
+		return;
+	}
+	result_cache.set_max_entries(capacity);
+}
+
+void Schema::set_result_cache_max_bytes(int64_t max_bytes) {
+	if (max_bytes < 0) {
+		UtilityFunctions::push_error("result_cache_max_bytes must not be negative");
+		return;
+	}
+	result_cache.set_max_bytes(max_bytes);
 }
 
 Ref<SchemaValidationResult> Schema::validate_uncompiled(const Dictionary &schema_dict) {
 	ValidationContext context(this);
-	rules->validate(schema_dict, context);
+	const CompiledState *state = get_compiled_state();
+	if (state && state->rules) {
+		state->rules->validate(schema_dict, context);
+	}
 	return SchemaValidationResult::from_context(context);
 }
 
 bool Schema::is_valid() const {
-	compilation_mutex->lock();
-	bool valid = is_compiled && compile_errors.size() == 0;
-	compilation_mutex->unlock();
-	return valid;
+	const CompiledState *state = get_compiled_state();
+	return state && state->errors.empty();
 }
 
 void Schema::set_compilation_result(std::shared_ptr<RuleGroup> compiled_rules, std::vector<SchemaCompileError> errors) {
-	compilation_mutex->lock();
-	rules = compiled_rules;
-	compile_errors = std::move(errors);
-	is_compiled = true;
-	compilation_mutex->unlock();
+	CompiledState *state = new CompiledState();
+	state->rules = compiled_rules;
+	state->errors = std::move(errors);
+
+	// First result wins, the state must not change under concurrent readers
+	const CompiledState *expected = nullptr;
+	if (!compiled_state.compare_exchange_strong(expected, state, std::memory_order_acq_rel, std::memory_order_acquire)) {
+		delete state;
+	}
 }
 
 Array Schema::get_compile_errors() {
-	if (compile_errors.empty()) {
+	const CompiledState *state = get_compiled_state();
+	if (!state || state->errors.empty()) {
 		return Array();
 	}
 
 	Array errors;
-	for (size_t i = 0; i < compile_errors.size(); i++) {
-		const auto &error = compile_errors[i];
+	for (size_t i = 0; i < state->errors.size(); i++) {
+		const auto &error = state->errors[i];
 
 		Dictionary error_dict;
 		error_dict["path"] = error.get_path_string();
@@ -786,10 +1265,12 @@ Array Schema::get_compile_errors() {
 }
 
 String Schema::get_compile_error_summary() {
-	if (!is_compiled) {
+	const CompiledState *state = get_compiled_state();
+	if (!state) {
 		return "Schema is not compiled";
 	}
 
+	const std::vector<SchemaCompileError> &compile_errors = state->errors;
 	if (compile_errors.empty()) {
 		return "";
 	}
@@ -1,18 +1,22 @@
 #pragma once
 
 #include "hashers.hpp"
+#include "program/rule_program.hpp"
 #include "rule/rule_group.hpp"
 #include "rule_factory.hpp"
 #include "schema_compile_error.hpp"
+#include "validation_context.hpp"
 #include "validation_result.hpp"
+#include "validation_result_cache.hpp"
 
-#include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +50,25 @@ public:
 	};
 
 private:
+	/**
+	 * @struct CompiledState
+	 * @brief Result of compiling a Schema, immutable once published
+	 */
+	struct CompiledState {
+		std::shared_ptr<RuleGroup> rules;
+		std::vector<SchemaCompileError> errors;
+
+		// Optional linearized form of the rules, lowered on first use
+		mutable std::once_flag program_flag;
+		mutable std::shared_ptr<RuleProgram> program;
+
+		/**
+		 * @brief Gets the rule program, lowering the rules on first use
+		 * @return The program, or null if there are no rules
+		 */
+		std::shared_ptr<RuleProgram> get_program() const;
+	};
+
 	// Tree structure
 	Ref<Schema> root_schema; // null for root node
 	StringName schema_path; // Path from root like "/properties/user"
@@ -60,12 +83,28 @@ private:
 	StringName title;
 	StringName description;
 	StringName comment;
+	uint64_t content_hash = 0; // Merkle hash of schema_definition, computed once children exist
+	bool references = false; // This node or a descendant has a $ref
+
+	// Compiled rules and errors, published once and read without locking
+	std::atomic<const CompiledState *> compiled_state{ nullptr };
+
+	// Validation options, read by every validation run
+	std::atomic<bool> use_rule_program{ false };
+	std::atomic<bool> use_validation_memo{ false };
+
+	// Error budgets applied by validate(), 0 for unlimited
+	std::atomic<int64_t> max_errors{ 0 };
+	std::atomic<int64_t> max_errors_per_subtree{ 0 };
+
+	// Minimum array size validated in parallel chunks, 0 to disable
+	std::atomic<int64_t> parallel_items_threshold{ 0 };
 
-	// Validation rules
-	mutable std::shared_ptr<RuleGroup> rules;
-	mutable std::vector<SchemaCompileError> compile_errors;
-	mutable bool is_compiled;
-	mutable Ref<Mutex> compilation_mutex;
+	// Maximum nesting of $ref evaluations
+	std::atomic<int64_t> max_depth{ ValidationContext::DEFAULT_MAX_DEPTH };
+
+	// Results of validate() by data content, disabled until a capacity is set
+	ValidationResultCache result_cache;
 
 	/**
 	 * @brief Determines Schema type from definition
@@ -109,6 +148,18 @@ private:
 	 */
 	void create_definitions_children(const Dictionary &dict, const StringName &key);
 
+	/**
+	 * @brief Computes content_hash and references from schema_definition and the children
+	 */
+	void compute_content_hash();
+
+	/**
+	 * @brief Compiles a newly constructed root Schema and registers it if it has an $id
+	 * @param schema The Schema
+	 * @return The same Schema
+	 */
+	static Ref<Schema> finish_build(const Ref<Schema> &schema);
+
 	/**
 	 * @brief Converts a Variant value to a Schema-compatible dictionary
 	 * @param value The Variant value to convert
@@ -116,12 +167,6 @@ private:
 	 */
 	Variant variant_to_schema_dict(const Variant &value) const;
 
-	/**
-	 * @brief Adds a compilation error to the list
-	 * @param error_message The error message
-	 */
-	void add_compile_error(const String error_message);
-
 	/**
 	 * @brief Normalizes a JSON Pointer by removing fragments and cleaning up
 	 * @param pointer The raw JSON pointer string
@@ -148,6 +193,40 @@ private:
 	 */
 	void compile();
 
+	/**
+	 * @brief Gets the published compilation result
+	 * @return The compiled state, or null if the Schema has not been compiled
+	 */
+	const CompiledState *get_compiled_state() const { return compiled_state.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Compiles the Schema if needed and gets the published compilation result
+	 * @return The compiled state, or null if compilation did not complete (e.g. a $ref cycle)
+	 */
+	const CompiledState *ensure_compiled();
+
+	/**
+	 * @brief Compiles the Schema if needed and takes the rules used for one validation run
+	 * @param out_rules Receives the compiled rules
+	 * @param out_program Receives the rule program, null if disabled
+	 * @param context Receives compile errors and the error limits
+	 * @return True if the Schema compiled and data can be validated
+	 */
+	bool prepare_validation(std::shared_ptr<RuleGroup> &out_rules, std::shared_ptr<RuleProgram> &out_program, ValidationContext &context);
+
+	/**
+	 * @brief Validates each element of an Array, optionally sharded across the WorkerThreadPool
+	 * @param documents The documents to validate
+	 * @param parallel If true, large batches are split into shards validated on worker threads
+	 * @return Batch result as returned by validate_batch()
+	 */
+	Dictionary run_batch_validation(const Array &documents, bool parallel);
+
+	/**
+	 * @brief Smallest number of documents validated by one worker task
+	 */
+	static constexpr int64_t MIN_BATCH_SHARD_SIZE = 16;
+
 	/**
 	 * @brief Validates an uncompiled Schema against this Schema
 	 * @param data The Schema to validate
@@ -179,9 +258,12 @@ public:
 	virtual ~Schema();
 
 	/**
-	 * @brief Sets the compilation result (rules and errors)
+	 * @brief Publishes the compilation result (rules and errors)
 	 * @param compiled_rules The compiled rule group
 	 * @param errors List of compilation errors
+	 *
+	 * Only the first result is published, results of racing compilations of
+	 * the same Schema are discarded so readers never see the state change.
 	 */
 	void set_compilation_result(std::shared_ptr<RuleGroup> compiled_rules, std::vector<SchemaCompileError> errors);
 
@@ -239,6 +321,83 @@ public:
 	 */
 	static Ref<Schema> load_from_json(const String &json_string, bool validate_against_meta = false);
 
+	/**
+	 * @brief Loads a Schema from a precompiled file written by save_to_compiled_file()
+	 * @param path Path to the .gdschemac file
+	 * @param fallback_json_path JSON Schema file loaded instead if the compiled file is missing, outdated or damaged
+	 * @param validate_against_meta If true, validate against meta-Schema unless the file records that it passed
+	 * @return New Schema instance or null on error
+	 *
+	 * Skips the JSON parser, and the meta-schema validation if it passed when
+	 * the file was written. A file saved with its JSON source is outdated once
+	 * that source's bytes differ from when it was saved.
+	 */
+	static Ref<Schema> load_from_compiled_file(const String &path, const String &fallback_json_path = "", bool validate_against_meta = false);
+
+	/**
+	 * @brief Saves the Schema to a precompiled file for load_from_compiled_file()
+	 * @param path Destination, usually with the .gdschemac extension
+	 * @param source_json_path JSON Schema file the Schema was loaded from, recorded to detect later edits
+	 * @return OK, or the error that prevented saving
+	 *
+	 * Only root Schemas without compile errors can be saved.
+	 */
+	Error save_to_compiled_file(const String &path, const String &source_json_path = "") const;
+
+	// ========== Compiled Rule Cache ==========
+
+	/**
+	 * @brief Sets how many compiled sub-schemas are kept for reuse by later compilations
+	 * @param capacity Maximum entries, 0 disables reuse
+	 *
+	 * Least recently used entries are evicted first. Compiled schemas keep
+	 * their rules when entries are evicted.
+	 */
+	static void set_rule_cache_capacity(int64_t capacity);
+
+	/**
+	 * @brief Gets how many compiled sub-schemas are kept for reuse
+	 * @return Maximum entries
+	 */
+	static int64_t get_rule_cache_capacity();
+
+	/**
+	 * @brief Limits the estimated memory of the compiled sub-schemas kept for reuse
+	 * @param max_bytes Maximum bytes, 0 for unlimited
+	 */
+	static void set_rule_cache_max_bytes(int64_t max_bytes);
+
+	/**
+	 * @brief Gets the memory limit of the compiled sub-schemas kept for reuse
+	 * @return Maximum bytes, 0 for unlimited
+	 */
+	static int64_t get_rule_cache_max_bytes();
+
+	/**
+	 * @brief Removes every compiled sub-schema kept for reuse
+	 */
+	static void clear_rule_cache();
+
+	/**
+	 * @brief Gets the counters of the compiled rule cache
+	 * @return Dictionary with "entries", "bytes", "hits", "misses" and "evictions"
+	 */
+	static Dictionary get_rule_cache_stats();
+
+	// ========== Compilation ==========
+
+	/**
+	 * @brief Sets the minimum number of sub-schemas directly under a root Schema compiled on worker threads
+	 * @param threshold Minimum sub-schema count (definitions, properties, ...), 0 to disable
+	 */
+	static void set_parallel_compile_threshold(int64_t threshold);
+
+	/**
+	 * @brief Gets the minimum number of sub-schemas directly under a root Schema compiled on worker threads
+	 * @return Minimum sub-schema count, 0 if disabled
+	 */
+	static int64_t get_parallel_compile_threshold();
+
 	// ========== Tree Navigation ==========
 
 	/**
@@ -328,6 +487,21 @@ public:
 	 */
 	StringName get_comment() const { return comment; }
 
+	/**
+	 * @brief Gets the hash of the Schema definition
+	 * @return Hash equal for Schemas with equal definitions
+	 *
+	 * Computed bottom-up when the Schema is constructed, each child's
+	 * definition is hashed once by the child.
+	 */
+	uint64_t get_content_hash() const { return content_hash; }
+
+	/**
+	 * @brief Checks if this Schema or a sub-schema contains a $ref
+	 * @return True if the compiled rules depend on the document the Schema belongs to
+	 */
+	bool has_references() const { return references; }
+
 	/**
 	 * @brief Checks if this is an object Schema
 	 * @return True if object type
@@ -463,6 +637,61 @@ public:
 	 */
 	Ref<SchemaValidationResult> validate(const Variant &data);
 
+	/**
+	 * @brief Validates data into a caller-owned result
+	 * @param data The data to validate
+	 * @param result The result to overwrite, must not be shared
+	 * @return True if data is valid
+	 *
+	 * Reusing one result across calls avoids allocating a result per
+	 * validation, even when it fails.
+	 */
+	bool validate_into(const Variant &data, const Ref<SchemaValidationResult> &result);
+
+	/**
+	 * @brief Checks if data is valid against this Schema without collecting errors
+	 * @param data The data to validate
+	 * @return True if data is valid
+	 *
+	 * Stops at the first failing rule and never formats error messages, use
+	 * validate() when error details are needed.
+	 */
+	bool is_data_valid(const Variant &data);
+
+	/**
+	 * @brief Validates each element of an Array against this Schema
+	 * @param documents The documents to validate
+	 * @return Dictionary with "valid" (PackedByteArray, 1 per valid document) and
+	 *         "errors" (Dictionary mapping failing indices to SchemaValidationResult)
+	 *
+	 * Compiled state is checked once and validation storage is reused across
+	 * documents, so this is cheaper than calling validate() per document.
+	 */
+	Dictionary validate_batch(const Array &documents);
+
+	/**
+	 * @brief Validates each element of an Array on the WorkerThreadPool
+	 * @param documents The documents to validate
+	 * @return Same as validate_batch(), in the same document order
+	 *
+	 * Documents are split into contiguous shards validated concurrently against
+	 * the shared, read-only compiled rules. Small batches run on the calling thread.
+	 */
+	Dictionary validate_batch_parallel(const Array &documents);
+
+	/**
+	 * @brief Revalidates a document after edits, reusing the results of a previous validate_patch()
+	 * @param data The edited document
+	 * @param previous Result of the previous validate_patch() on the same document, or null
+	 * @param changed_paths JSON Pointers of every value added, removed or modified since then
+	 * @return Result identical to validate(), carrying the state for the next call
+	 *
+	 * Only the containers on the changed paths and below them are validated
+	 * again, every other Dictionary and Array replays its recorded result. The
+	 * state moves from previous to the returned result.
+	 */
+	Ref<SchemaValidationResult> validate_patch(const Variant &data, const Ref<SchemaValidationResult> &previous, const PackedStringArray &changed_paths);
+
 	/**
 	 * @brief Checks if the Schema is valid (no compilation errors)
 	 * @return True if Schema compiled successfully
@@ -481,6 +710,125 @@ public:
 	 */
 	String get_compile_error_summary();
 
+	/**
+	 * @brief Enables executing validation as a linearized rule program
+	 * @param enabled If true, rules are lowered into a flat instruction array on first use
+	 */
+	void set_use_rule_program(bool enabled);
+
+	/**
+	 * @brief Checks if validation executes as a linearized rule program
+	 * @return True if the rule program is enabled
+	 */
+	bool is_using_rule_program() const { return use_rule_program.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Enables memoizing $ref targets per container during a validation run
+	 * @param enabled If true, a Dictionary or Array reached through the same $ref target more than once is validated once
+	 *
+	 * Cyclic data validates instead of failing on the maximum depth.
+	 */
+	void set_use_validation_memo(bool enabled);
+
+	/**
+	 * @brief Checks if $ref targets are memoized per container
+	 * @return True if the validation memo is enabled
+	 */
+	bool is_using_validation_memo() const { return use_validation_memo.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Limits the number of errors validate() collects
+	 * @param p_max_errors Maximum errors, 0 for unlimited
+	 *
+	 * Validation stops traversing the data once the limit is reached.
+	 */
+	void set_max_errors(int64_t p_max_errors);
+
+	/**
+	 * @brief Gets the error limit of validate()
+	 * @return Maximum errors, 0 for unlimited
+	 */
+	int64_t get_max_errors() const { return max_errors.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Limits the number of errors validate() collects under any array item or property value
+	 * @param p_max_errors Maximum errors per subtree, 0 for unlimited
+	 *
+	 * Validation skips the rest of a subtree once its limit is reached.
+	 */
+	void set_max_errors_per_subtree(int64_t p_max_errors);
+
+	/**
+	 * @brief Gets the per-subtree error limit of validate()
+	 * @return Maximum errors per subtree, 0 for unlimited
+	 */
+	int64_t get_max_errors_per_subtree() const { return max_errors_per_subtree.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Sets the array size from which "items" are validated in parallel chunks
+	 * @param threshold Minimum item count, 0 to disable
+	 */
+	void set_parallel_items_threshold(int64_t threshold);
+
+	/**
+	 * @brief Gets the array size from which "items" are validated in parallel chunks
+	 * @return Minimum item count, 0 if disabled
+	 */
+	int64_t get_parallel_items_threshold() const { return parallel_items_threshold.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Limits how deeply $ref evaluations may nest during validation
+	 * @param p_max_depth Maximum depth, at least 1
+	 *
+	 * Exceeding the limit fails validation with a "maxDepth" error.
+	 */
+	void set_max_depth(int64_t p_max_depth);
+
+	/**
+	 * @brief Gets the maximum nesting of $ref evaluations
+	 * @return Maximum depth
+	 */
+	int64_t get_max_depth() const { return max_depth.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Sets how many results validate() and is_data_valid() cache by data content
+	 * @param capacity Maximum cached results, 0 disables the cache
+	 *
+	 * Validating data equal to a cached document costs one hash pass over the
+	 * data and returns the cached result. Data containing Objects or math types
+	 * is never cached.
+	 */
+	void set_result_cache_capacity(int64_t capacity);
+
+	/**
+	 * @brief Gets how many results are cached by data content
+	 * @return Maximum cached results, 0 if disabled
+	 */
+	int64_t get_result_cache_capacity() const { return result_cache.get_max_entries(); }
+
+	/**
+	 * @brief Limits the estimated memory of the cached results
+	 * @param max_bytes Maximum bytes, 0 for unlimited
+	 */
+	void set_result_cache_max_bytes(int64_t max_bytes);
+
+	/**
+	 * @brief Gets the memory limit of the cached results
+	 * @return Maximum bytes, 0 for unlimited
+	 */
+	int64_t get_result_cache_max_bytes() const { return result_cache.get_max_bytes(); }
+
+	/**
+	 * @brief Removes every cached result
+	 */
+	void clear_result_cache() { result_cache.clear(); }
+
+	/**
+	 * @brief Gets the counters of the result cache
+	 * @return Dictionary with "hits", "misses", "entries" and "bytes"
+	 */
+	Dictionary get_result_cache_stats() const { return result_cache.get_stats(); }
+
 	// ========== Debugging ==========
 
 	/**
@@ -20,8 +20,9 @@ public:
 	explicit AdditionalItemsSelector(int tuple_len) :
 			tuple_length(tuple_len) {}
 
-	std::vector<SelectionTarget> select_targets(const Variant &instance, const ValidationContext &context) const override;
+	void select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const override;
 
+	uint32_t get_applicable_types(const ValidationRule &rule) const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override { return vformat("array[%d:]", tuple_length); }
 };
 
@@ -1,66 +1,26 @@
 #include "array_items_selector.hpp"
+#include "../program/rule_program.hpp"
+#include "../util.hpp"
+
+#include <limits>
 
 using namespace godot;
 
-std::vector<SelectionTarget> ArrayItemsSelector::select_targets(const Variant &instance, const ValidationContext &context) const {
-	std::vector<SelectionTarget> targets;
+void ArrayItemsSelector::select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const {
+	visit_array_items(instance, 0, std::numeric_limits<int64_t>::max(), visitor);
+}
 
-	if (instance.get_type() == Variant::ARRAY) {
-		Array arr = instance.operator Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(arr[i], String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_BYTE_ARRAY) {
-		PackedByteArray arr = instance.operator PackedByteArray();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_COLOR_ARRAY) {
-		PackedColorArray arr = instance.operator PackedColorArray();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_FLOAT32_ARRAY) {
-		PackedFloat32Array arr = instance.operator PackedFloat32Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_FLOAT64_ARRAY) {
-		PackedFloat64Array arr = instance.operator PackedFloat64Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_INT32_ARRAY) {
-		PackedInt32Array arr = instance.operator PackedInt32Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_INT64_ARRAY) {
-		PackedInt64Array arr = instance.operator PackedInt64Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_STRING_ARRAY) {
-		PackedStringArray arr = instance.operator PackedStringArray();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_VECTOR2_ARRAY) {
-		PackedVector2Array arr = instance.operator PackedVector2Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_VECTOR3_ARRAY) {
-		PackedVector3Array arr = instance.operator PackedVector3Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	} else if (instance.get_type() == Variant::PACKED_VECTOR4_ARRAY) {
-		PackedVector4Array arr = instance.operator PackedVector4Array();
-		for (int i = 0; i < arr.size(); i++) {
-			targets.emplace_back(Variant(arr[i]), String::num(i));
-		}
-	}
+int64_t ArrayItemsSelector::get_range_target_count(const Variant &instance) const {
+	return SchemaUtil::get_array_size(instance);
+}
+
+void ArrayItemsSelector::select_target_range(const Variant &instance, int64_t begin, int64_t end, SelectionVisitor &visitor) const {
+	visit_array_items(instance, begin, end, visitor);
+}
 
-	return targets;
+bool ArrayItemsSelector::lower(RuleProgramBuilder &builder, const ValidationRule &rule) const {
+	builder.begin_items();
+	rule.lower(builder);
+	builder.end_items();
+	return true;
 }
@@ -14,8 +14,13 @@ namespace godot {
  */
 class ArrayItemsSelector : public Selector {
 public:
-	std::vector<SelectionTarget> select_targets(const Variant &instance, const ValidationContext &context) const override;
+	void select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const override;
+	bool lower(RuleProgramBuilder &builder, const ValidationRule &rule) const override;
+	int64_t get_range_target_count(const Variant &instance) const override;
+	void select_target_range(const Variant &instance, int64_t begin, int64_t end, SelectionVisitor &visitor) const override;
+	bool selects_all_items() const override { return true; }
 
+	uint32_t get_applicable_types(const ValidationRule &rule) const override { return SchemaUtil::JSON_TYPE_ARRAY_LIKE; }
 	String get_description() const override { return "array[*]"; }
 };
 
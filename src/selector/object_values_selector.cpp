@@ -2,17 +2,16 @@
 
 using namespace godot;
 
-std::vector<SelectionTarget> ObjectValuesSelector::select_targets(const Variant &instance, const ValidationContext &context) const {
-	std::vector<SelectionTarget> targets;
+void ObjectValuesSelector::select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const {
+	if (instance.get_type() != Variant::DICTIONARY) {
+		return;
+	}
 
-	if (instance.get_type() == Variant::DICTIONARY) {
-		Dictionary dict = instance.operator Dictionary();
-		Array keys = dict.keys();
-		for (int i = 0; i < keys.size(); i++) {
-			String key_str = String(keys[i]);
-			targets.emplace_back(dict[keys[i]], key_str);
+	const Dictionary dict = instance.operator Dictionary();
+	const Array keys = dict.keys();
+	for (int64_t i = 0; i < keys.size(); i++) {
+		if (!visitor.visit(dict[keys[i]], PathSegment(String(keys[i])))) {
+			return;
 		}
 	}
-
-	return targets;
 }
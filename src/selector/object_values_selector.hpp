@@ -14,8 +14,9 @@ namespace godot {
  */
 class ObjectValuesSelector : public Selector {
 public:
-	std::vector<SelectionTarget> select_targets(const Variant &instance, const ValidationContext &context) const override;
+	void select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const override;
 
+	uint32_t get_applicable_types(const ValidationRule &rule) const override { return SchemaUtil::JSON_TYPE_OBJECT; }
 	String get_description() const override { return "object.values()"; }
 };
 
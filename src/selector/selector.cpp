@@ -0,0 +1,65 @@
+#include "selector.hpp"
+
+#include <algorithm>
+
+using namespace godot;
+
+template <typename T>
+static void visit_packed_items(const T &arr, int64_t begin, int64_t end, SelectionVisitor &visitor) {
+	end = std::min(end, static_cast<int64_t>(arr.size()));
+	for (int64_t i = begin; i < end; i++) {
+		if (!visitor.visit(Variant(arr[i]), PathSegment(i))) {
+			return;
+		}
+	}
+}
+
+void Selector::visit_array_items(const Variant &instance, int64_t begin, int64_t end, SelectionVisitor &visitor) {
+	if (begin < 0) {
+		begin = 0;
+	}
+
+	switch (instance.get_type()) {
+		case Variant::ARRAY: {
+			const Array arr = instance.operator Array();
+			end = std::min(end, static_cast<int64_t>(arr.size()));
+			for (int64_t i = begin; i < end; i++) {
+				if (!visitor.visit(arr[i], PathSegment(i))) {
+					return;
+				}
+			}
+		} break;
+		case Variant::PACKED_BYTE_ARRAY:
+			visit_packed_items(instance.operator PackedByteArray(), begin, end, visitor);
+			break;
+		case Variant::PACKED_COLOR_ARRAY:
+			visit_packed_items(instance.operator PackedColorArray(), begin, end, visitor);
+			break;
+		case Variant::PACKED_FLOAT32_ARRAY:
+			visit_packed_items(instance.operator PackedFloat32Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_FLOAT64_ARRAY:
+			visit_packed_items(instance.operator PackedFloat64Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_INT32_ARRAY:
+			visit_packed_items(instance.operator PackedInt32Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_INT64_ARRAY:
+			visit_packed_items(instance.operator PackedInt64Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_STRING_ARRAY:
+			visit_packed_items(instance.operator PackedStringArray(), begin, end, visitor);
+			break;
+		case Variant::PACKED_VECTOR2_ARRAY:
+			visit_packed_items(instance.operator PackedVector2Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_VECTOR3_ARRAY:
+			visit_packed_items(instance.operator PackedVector3Array(), begin, end, visitor);
+			break;
+		case Variant::PACKED_VECTOR4_ARRAY:
+			visit_packed_items(instance.operator PackedVector4Array(), begin, end, visitor);
+			break;
+		default:
+			break;
+	}
+}
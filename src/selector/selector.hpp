@@ -1,30 +1,36 @@
 #pragma once
 
+#include "../path_segment.hpp"
 #include "../rule/validation_rule.hpp"
 #include "../validation_context.hpp"
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include <cstdint>
 #include <memory>
-#include <vector>
 
 namespace godot {
 
 // Forward declarations
+class RuleProgramBuilder;
 class ValidationContext;
 
 /**
- * @struct SelectionTarget
- * @brief Represents a selected value with its context path
+ * @class SelectionVisitor
+ * @brief Receives the values chosen by a Selector one at a time
  */
-struct SelectionTarget {
-	Variant value;
-	String path_segment; // For building instance paths
+class SelectionVisitor {
+public:
+	virtual ~SelectionVisitor() = default;
 
-	SelectionTarget(const Variant &val, const String &segment = "") :
-			value(val),
-			path_segment(segment) {}
+	/**
+	 * @brief Visits a selected value
+	 * @param value The selected value, borrowed for the duration of the call
+	 * @param segment Instance path segment of the value (empty for the instance itself)
+	 * @return False to stop the selection early
+	 */
+	virtual bool visit(const Variant &value, const PathSegment &segment) = 0;
 };
 
 /**
@@ -36,18 +42,68 @@ public:
 	virtual ~Selector() = default;
 
 	/**
-	 * @brief Selects target values from the instance
+	 * @brief Selects target values from the instance and passes them to a visitor
 	 * @param instance The value to select from
 	 * @param context Current validation context
-	 * @return Array of SelectionTarget structs
+	 * @param visitor Visitor receiving each selected value in order
 	 */
-	virtual std::vector<SelectionTarget> select_targets(const Variant &instance, const ValidationContext &context) const = 0;
+	virtual void select_targets(const Variant &instance, const ValidationContext &context, SelectionVisitor &visitor) const = 0;
 
 	/**
 	 * @brief Gets a description of this selector for debugging
 	 * @return Description string
 	 */
 	virtual String get_description() const = 0;
+
+	/**
+	 * @brief Gets the JSON types of instances this selector can select values from
+	 * @param rule The rule applied to the selected values
+	 * @return SchemaUtil::JsonTypeFlags, the selector applied to the rule always passes for other types
+	 */
+	virtual uint32_t get_applicable_types(const ValidationRule &rule) const { return SchemaUtil::JSON_TYPE_ANY; }
+
+	/**
+	 * @brief Lowers this selector applied to a rule into a linearized rule program
+	 * @param builder Builder receiving the instructions
+	 * @param rule The rule applied to the selected values
+	 * @return False if the selector has no instruction form and nothing was emitted
+	 */
+	virtual bool lower(RuleProgramBuilder &builder, const ValidationRule &rule) const { return false; }
+
+	/**
+	 * @brief Checks if this selector selects every item of an array
+	 * @return True if every item is selected, under its index segment
+	 */
+	virtual bool selects_all_items() const { return false; }
+
+	/**
+	 * @brief Gets the number of targets that can be selected independently by index range
+	 * @param instance The value to select from
+	 * @return Target count, or -1 if this selector cannot select index ranges
+	 */
+	virtual int64_t get_range_target_count(const Variant &instance) const { return -1; }
+
+	/**
+	 * @brief Selects the targets in the index range [begin, end)
+	 * @param instance The value to select from
+	 * @param begin First target index
+	 * @param end One past the last target index
+	 * @param visitor Visitor receiving each selected value in order
+	 *
+	 * Only called on selectors whose get_range_target_count() is not negative.
+	 * Ranges may be selected concurrently from several threads.
+	 */
+	virtual void select_target_range(const Variant &instance, int64_t begin, int64_t end, SelectionVisitor &visitor) const {}
+
+protected:
+	/**
+	 * @brief Visits the items of an Array or packed array in the index range [begin, end)
+	 * @param instance The array-like value
+	 * @param begin First index to visit
+	 * @param end One past the last index to visit (clamped to the array size)
+	 * @param visitor Visitor receiving each item
+	 */
+	static void visit_array_items(const Variant &instance, int64_t begin, int64_t end, SelectionVisitor &visitor);
 };
 
 } // namespace godot
@@ -1,9 +1,49 @@
+#pragma once
+
 #include <godot_cpp/variant/variant.hpp>
 
+#include <cstdint>
+
 namespace godot {
 
 class SchemaUtil {
 public:
+	/**
+	 * @brief Bit flags for the JSON types reported by get_variant_json_type()
+	 */
+	enum JsonTypeFlags : uint32_t {
+		JSON_TYPE_NULL = 1 << 0,
+		JSON_TYPE_BOOLEAN = 1 << 1,
+		JSON_TYPE_INTEGER = 1 << 2,
+		JSON_TYPE_NUMBER = 1 << 3, // Numbers with a fractional part
+		JSON_TYPE_STRING = 1 << 4,
+		JSON_TYPE_ARRAY = 1 << 5,
+		JSON_TYPE_OBJECT = 1 << 6,
+		JSON_TYPE_UNKNOWN = 1 << 7,
+		JSON_TYPE_ANY = 0xFF,
+		JSON_TYPE_NUMERIC = JSON_TYPE_INTEGER | JSON_TYPE_NUMBER,
+		JSON_TYPE_ARRAY_LIKE = JSON_TYPE_ARRAY | JSON_TYPE_UNKNOWN, // get_array_size() also accepts PackedByteArray
+	};
+
+	/**
+	 * @brief Number of distinct JsonTypeFlags bits
+	 */
+	static constexpr int JSON_TYPE_COUNT = 8;
+
+	/**
+	 * @brief Gets the bit index of a single JsonTypeFlags bit
+	 * @param type_flag A flag returned by get_variant_json_type_flag()
+	 * @return Index in the range [0, JSON_TYPE_COUNT)
+	 */
+	static int get_json_type_index(uint32_t type_flag) {
+		int index = 0;
+		while (type_flag > 1) {
+			type_flag >>= 1;
+			index++;
+		}
+		return index;
+	}
+
 	static int64_t get_array_size(const Variant &value) {
 		switch (value.get_type()) {
 			case Variant::ARRAY:
@@ -62,6 +102,51 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Gets the UTF-8 byte length of a String without converting it
+	 * @param str The string
+	 * @return Same length as str.utf8().length()
+	 */
+	static int64_t utf8_length(const String &str) {
+		const char32_t *chars = str.ptr();
+		const int64_t count = str.length();
+		int64_t length = 0;
+		for (int64_t i = 0; i < count; i++) {
+			const char32_t c = chars[i];
+			if (c < 0x80) {
+				length += 1;
+			} else if (c < 0x800) {
+				length += 2;
+			} else if (c < 0x10000 || c > 0x10FFFF) {
+				length += 3; // Invalid code points are encoded as U+FFFD
+			} else {
+				length += 4;
+			}
+		}
+		return length;
+	}
+
+	/**
+	 * @brief Gets the identity of a Dictionary or Array
+	 * @param value The variant to analyze
+	 * @return Identity shared by every reference to the same container, 0 for other types
+	 */
+	static uintptr_t get_container_id(const Variant &value) {
+		switch (value.get_type()) {
+			case Variant::DICTIONARY: {
+				// The opaque storage of a reference holds the pointer to the shared data
+				const Dictionary dict = value;
+				return *static_cast<const uintptr_t *>(dict._native_ptr());
+			}
+			case Variant::ARRAY: {
+				const Array array = value;
+				return *static_cast<const uintptr_t *>(array._native_ptr());
+			}
+			default:
+				return 0;
+		}
+	}
+
 	/**
 	 * @brief Helper to get variant type name for error messages
 	 * @param value The variant to analyze
@@ -101,6 +186,106 @@ public:
 				return "unknown";
 		}
 	}
+
+	/**
+	 * @brief Gets the JSON type of a Variant as a single JsonTypeFlags bit
+	 * @param value The variant to analyze
+	 * @return Type flag matching get_variant_json_type()
+	 */
+	static uint32_t get_variant_json_type_flag(const Variant &value) {
+		switch (value.get_type()) {
+			case Variant::NIL:
+				return JSON_TYPE_NULL;
+			case Variant::BOOL:
+				return JSON_TYPE_BOOLEAN;
+			case Variant::INT:
+				return JSON_TYPE_INTEGER;
+			case Variant::FLOAT:
+				if (value.operator double() == static_cast<double>(static_cast<int64_t>(value.operator double()))) {
+					return JSON_TYPE_INTEGER; // Float with no fractional part is considered integer
+				}
+				return JSON_TYPE_NUMBER;
+			case Variant::STRING:
+			case Variant::STRING_NAME:
+				return JSON_TYPE_STRING;
+			case Variant::ARRAY:
+			case Variant::PACKED_COLOR_ARRAY:
+			case Variant::PACKED_FLOAT32_ARRAY:
+			case Variant::PACKED_FLOAT64_ARRAY:
+			case Variant::PACKED_INT32_ARRAY:
+			case Variant::PACKED_INT64_ARRAY:
+			case Variant::PACKED_STRING_ARRAY:
+			case Variant::PACKED_VECTOR2_ARRAY:
+			case Variant::PACKED_VECTOR3_ARRAY:
+			case Variant::PACKED_VECTOR4_ARRAY:
+				return JSON_TYPE_ARRAY;
+			case Variant::DICTIONARY:
+			case Variant::OBJECT:
+				return JSON_TYPE_OBJECT;
+			default:
+				return JSON_TYPE_UNKNOWN;
+		}
+	}
+
+	/**
+	 * @brief Gets the JsonTypeFlags accepted by a JSON Schema type name
+	 * @param type_name Type name like "string" or "number"
+	 * @return Accepted type flags ("number" also accepts integers), 0 for unrecognized names
+	 */
+	static uint32_t get_json_type_flags(const String &type_name) {
+		if (type_name == "null") {
+			return JSON_TYPE_NULL;
+		} else if (type_name == "boolean") {
+			return JSON_TYPE_BOOLEAN;
+		} else if (type_name == "integer") {
+			return JSON_TYPE_INTEGER;
+		} else if (type_name == "number") {
+			return JSON_TYPE_INTEGER | JSON_TYPE_NUMBER;
+		} else if (type_name == "string") {
+			return JSON_TYPE_STRING;
+		} else if (type_name == "array") {
+			return JSON_TYPE_ARRAY;
+		} else if (type_name == "object") {
+			return JSON_TYPE_OBJECT;
+		} else if (type_name == "unknown") {
+			return JSON_TYPE_UNKNOWN;
+		}
+		return 0;
+	}
+
+	/**
+	 * @class PoolTaskScope
+	 * @brief Marks the current thread as running one of the extension's WorkerThreadPool tasks
+	 *
+	 * Work that would wait for a task group checks is_in_pool_task() and runs
+	 * inline instead, a waiting task holds its worker from the pool.
+	 */
+	class PoolTaskScope {
+	private:
+		bool previous;
+
+	public:
+		PoolTaskScope() :
+				previous(pool_task_flag()) { pool_task_flag() = true; }
+		~PoolTaskScope() { pool_task_flag() = previous; }
+
+		PoolTaskScope(const PoolTaskScope &) = delete;
+		PoolTaskScope &operator=(const PoolTaskScope &) = delete;
+	};
+
+	/**
+	 * @brief Checks if the current thread runs inside a PoolTaskScope
+	 * @return True on a worker running one of the extension's tasks
+	 */
+	static bool is_in_pool_task() {
+		return pool_task_flag();
+	}
+
+private:
+	static bool &pool_task_flag() {
+		static thread_local bool in_pool_task = false;
+		return in_pool_task;
+	}
 };
 
 } //namespace godot
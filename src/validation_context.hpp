@@ -1,6 +1,8 @@
 #pragma once
 
+#include "path_segment.hpp"
 #include "validation_error.hpp"
+#include "validation_snapshot.hpp"
 
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
@@ -9,6 +11,11 @@
 #include <godot_cpp/variant/variant.hpp>
 
 #include <godot_cpp/variant/utility_functions.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
 #include <vector>
 
 namespace godot {
@@ -19,92 +26,562 @@ class Schema;
 /**
  * @class ValidationContext
  * @brief Context for tracking validation state and collecting errors
+ *
+ * A single context is shared by the whole validation run. Instance and Schema
+ * paths are kept as segment stacks that rules push and pop while descending,
+ * and are only materialized into PackedStringArrays when an error is recorded.
+ * Instance segments are PathSegments, so array indices are formatted lazily.
+ *
+ * A context created with error collection disabled runs in fail-fast mode:
+ * rules stop at the first failure and no error messages are formatted.
+ * The same happens once an error budget set with set_error_limits() is
+ * exhausted, which bounds the cost of validating badly malformed data.
  */
 class ValidationContext {
+public:
+	/**
+	 * @brief State of a (rules, container) pair in the validation memo
+	 */
+	enum MemoState : uint8_t {
+		MEMO_MISS, // Not validated yet
+		MEMO_IN_PROGRESS, // Being validated further up, the data is cyclic
+		MEMO_VALID,
+		MEMO_INVALID,
+	};
+
 private:
-	PackedStringArray instance_path_parts;
-	PackedStringArray schema_path_parts;
+	struct MemoKey {
+		const void *rules;
+		uintptr_t container_id;
+
+		bool operator==(const MemoKey &other) const { return rules == other.rules && container_id == other.container_id; }
+	};
+
+	struct MemoKeyHasher {
+		size_t operator()(const MemoKey &key) const {
+			return std::hash<const void *>()(key.rules) ^ (std::hash<uintptr_t>()(key.container_id) * 31);
+		}
+	};
+
+	struct MemoEntry {
+		MemoState state = MEMO_MISS;
+		size_t depth = 0; // Nesting of in-progress entries when this one was entered
+	};
+
+	std::vector<PathSegment> instance_path_stack;
+	std::vector<size_t> subtree_error_bases; // Error count when each instance_path_stack segment was entered
+	std::vector<String> schema_path_stack;
 	const Schema *source_schema; // Weak reference to avoid cycles
 	std::vector<ValidationError> errors;
 	Dictionary custom_data;
+	bool collect_errors;
+	size_t max_errors = 0; // 0 for unlimited
+	size_t max_errors_per_subtree = 0; // 0 for unlimited
+	int64_t parallel_items_threshold = 0; // Minimum array size validated in parallel chunks, 0 to disable
+	int64_t max_depth = DEFAULT_MAX_DEPTH; // Maximum nesting of $ref evaluations
+	int64_t depth = 0; // Current nesting of $ref evaluations
+	bool memoize = false; // Validate each (rules, container) pair once
+	std::unordered_map<MemoKey, MemoEntry, MemoKeyHasher> memo;
+	size_t memo_depth = 0; // Number of in-progress memo entries
+	size_t memo_low = std::numeric_limits<size_t>::max(); // Shallowest in-progress entry assumed valid since the innermost begin_memo()
+	ValidationSnapshot *snapshot = nullptr; // Results reused and recorded by RuleGroups, owned by the caller
+
+	static PackedStringArray materialize_path(const std::vector<PathSegment> &stack) {
+		PackedStringArray parts;
+		parts.resize(stack.size());
+		for (size_t i = 0; i < stack.size(); i++) {
+			parts[i] = stack[i].to_string();
+		}
+		return parts;
+	}
+
+	static PackedStringArray materialize_path(const std::vector<String> &stack) {
+		PackedStringArray parts;
+		parts.resize(stack.size());
+		for (size_t i = 0; i < stack.size(); i++) {
+			parts[i] = stack[i];
+		}
+		return parts;
+	}
+
+	template <typename T>
+	static String join_path(const std::vector<T> &stack) {
+		if (stack.empty()) {
+			return String();
+		}
+		return "/" + String("/").join(materialize_path(stack));
+	}
 
 public:
+	/**
+	 * @brief Default maximum nesting of $ref evaluations
+	 */
+	static constexpr int64_t DEFAULT_MAX_DEPTH = 50;
+
 	/**
 	 * @brief Constructor
 	 * @param schema Source Schema (can be null)
-	 * @param inst_path Current instance path
-	 * @param sch_path Current Schema path
+	 * @param collect If false, errors are not recorded and validation stops at the first failure
+	 */
+	explicit ValidationContext(const Schema *schema = nullptr, bool collect = true) :
+			source_schema(schema), collect_errors(collect) {
+		instance_path_stack.reserve(16);
+		subtree_error_bases.reserve(16);
+		schema_path_stack.reserve(16);
+	}
+
+	/**
+	 * @brief Appends a segment to the instance path
+	 * @param segment The segment to append
+	 * @return True if the segment was appended, false for empty segments
+	 *
+	 * Prefer InstanceScope, this is for callers that cannot use RAII such as
+	 * the rule program interpreter. Each successful push must be popped.
+	 */
+	bool push_instance_segment(const PathSegment &segment) {
+		if (segment.is_empty()) {
+			return false;
+		}
+		instance_path_stack.push_back(segment);
+		subtree_error_bases.push_back(errors.size());
+		return true;
+	}
+
+	/**
+	 * @brief Removes the last segment from the instance path
+	 */
+	void pop_instance_segment() {
+		instance_path_stack.pop_back();
+		subtree_error_bases.pop_back();
+	}
+
+	/**
+	 * @brief Appends a segment to the Schema path
+	 * @param segment The segment to append
+	 * @return True if the segment was appended, false for empty segments
+	 *
+	 * Prefer SchemaScope, this is for the rule program interpreter. Each
+	 * successful push must be popped.
+	 */
+	bool push_schema_segment(const String &segment) {
+		if (segment.is_empty()) {
+			return false;
+		}
+		schema_path_stack.push_back(segment);
+		return true;
+	}
+
+	/**
+	 * @brief Removes the last segment from the Schema path
+	 */
+	void pop_schema_segment() { schema_path_stack.pop_back(); }
+
+	/**
+	 * @brief Sets the maximum nesting of $ref evaluations
+	 * @param p_max_depth Maximum depth, exceeding it fails validation
+	 */
+	void set_max_depth(int64_t p_max_depth) { max_depth = p_max_depth; }
+
+	/**
+	 * @brief Gets the maximum nesting of $ref evaluations
+	 * @return Maximum depth
+	 */
+	int64_t get_max_depth() const { return max_depth; }
+
+	/**
+	 * @brief Enters a $ref evaluation
+	 * @return False if the maximum depth is reached, the depth is then unchanged
+	 */
+	bool enter_reference() {
+		if (depth >= max_depth) {
+			return false;
+		}
+		depth++;
+		return true;
+	}
+
+	/**
+	 * @brief Leaves a $ref evaluation entered with enter_reference()
+	 */
+	void exit_reference() { depth--; }
+
+	/**
+	 * @brief Enables the validation memo
+	 * @param enabled If true, containers shared between several places are validated once per rule set
+	 *
+	 * Cyclic data validates instead of reaching the maximum depth: a pair that
+	 * is reached again while it is still being validated is assumed valid.
+	 */
+	void set_memoize(bool enabled) { memoize = enabled; }
+
+	/**
+	 * @brief Checks if the validation memo is enabled
+	 * @return True if results are memoized
+	 */
+	bool is_memoizing() const { return memoize; }
+
+	/**
+	 * @brief Looks up the memoized result of validating a container against a rule set
+	 * @param rules Identity of the compiled rules
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 * @return MEMO_MISS if the pair has not been validated
+	 *
+	 * On MEMO_INVALID in error collecting mode the pair should be validated
+	 * again, so the errors are reported at the current instance path.
+	 */
+	MemoState lookup_memo(const void *rules, uintptr_t container_id) {
+		const auto entry = memo.find(MemoKey{ rules, container_id });
+		if (entry == memo.end()) {
+			return MEMO_MISS;
+		}
+		if (entry->second.state == MEMO_IN_PROGRESS) {
+			// Results of the entries entered since then depend on this assumption
+			memo_low = std::min(memo_low, entry->second.depth);
+		}
+		return entry->second.state;
+	}
+
+	/**
+	 * @brief Marks a container as being validated against a rule set
+	 * @param rules Identity of the compiled rules
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 * @return Token to pass to end_memo()
+	 */
+	size_t begin_memo(const void *rules, uintptr_t container_id) {
+		const size_t token = memo_low;
+		memo_low = std::numeric_limits<size_t>::max();
+		memo[MemoKey{ rules, container_id }] = MemoEntry{ MEMO_IN_PROGRESS, ++memo_depth };
+		return token;
+	}
+
+	/**
+	 * @brief Records the result of a validation started with begin_memo()
+	 * @param rules Identity of the compiled rules
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 * @param token Value returned by begin_memo()
+	 * @param valid The validation result
+	 *
+	 * A valid result that relied on an enclosing pair being valid is
+	 * provisional and is forgotten instead of memoized. Invalid results are
+	 * always final.
+	 */
+	void end_memo(const void *rules, uintptr_t container_id, size_t token, bool valid) {
+		const size_t entry_depth = memo_depth--;
+		const auto entry = memo.find(MemoKey{ rules, container_id });
+		if (entry != memo.end()) {
+			if (valid && memo_low < entry_depth) {
+				memo.erase(entry);
+			} else {
+				entry->second.state = valid ? MEMO_VALID : MEMO_INVALID;
+			}
+		}
+		memo_low = std::min(memo_low, token);
+	}
+
+	/**
+	 * @brief Sets the snapshot RuleGroups reuse results from and record results to
+	 * @param p_snapshot The snapshot, null to disable
+	 *
+	 * Recorded errors are only complete when every error is collected, so
+	 * only use a snapshot in error collecting mode without error limits.
+	 */
+	void set_snapshot(ValidationSnapshot *p_snapshot) { snapshot = p_snapshot; }
+
+	/**
+	 * @brief Gets the snapshot set with set_snapshot()
+	 * @return The snapshot, or null
+	 */
+	ValidationSnapshot *get_snapshot() const { return snapshot; }
+
+	/**
+	 * @brief Gets the length of the instance path
+	 * @return Number of instance path segments
 	 */
-	ValidationContext(const Schema *schema = nullptr,
-			const PackedStringArray &inst_parts = PackedStringArray(),
-			const PackedStringArray &sch_parts = PackedStringArray()) :
-			source_schema(schema), instance_path_parts(inst_parts), schema_path_parts(sch_parts) {}
+	size_t get_instance_depth() const { return instance_path_stack.size(); }
 
 	/**
-	 * @brief Creates a child context for validating a sub-instance
-	 * @param segment Path segment to append to instance path
-	 * @return New validation context with updated instance path
+	 * @brief Gets the length of the Schema path
+	 * @return Number of Schema path segments
 	 */
-	ValidationContext create_child_instance(const String &segment) const {
-		PackedStringArray new_parts = instance_path_parts;
-		if (!segment.is_empty()) {
-			new_parts.push_back(segment);
+	size_t get_schema_depth() const { return schema_path_stack.size(); }
+
+	/**
+	 * @brief Copies the errors recorded after a checkpoint
+	 * @param count Checkpoint previously returned by error_count()
+	 * @return The errors, with frozen data arguments since the copies outlive the validation
+	 */
+	std::vector<ValidationError> copy_errors_since(size_t count) const {
+		if (count >= errors.size()) {
+			return std::vector<ValidationError>();
 		}
-		return ValidationContext(source_schema, new_parts, schema_path_parts);
+		std::vector<ValidationError> copied(errors.begin() + count, errors.end());
+		for (ValidationError &error : copied) {
+			error.freeze_message_args();
+		}
+		return copied;
 	}
 
 	/**
-	 * @brief Creates a child context for a sub-schema
-	 * @param segment Path segment to append to Schema path
-	 * @return New validation context with updated Schema path
+	 * @brief Appends errors recorded at another position, moving their paths to the current position
+	 * @param recorded The errors
+	 * @param instance_depth Instance path length when the errors were recorded
+	 * @param schema_depth Schema path length when the errors were recorded
 	 */
-	ValidationContext create_child_schema(const String &segment) const {
-		PackedStringArray new_parts = schema_path_parts;
-		if (!segment.is_empty()) {
-			new_parts.push_back(segment);
+	void replay_errors(const std::vector<ValidationError> &recorded, size_t instance_depth, size_t schema_depth) {
+		if (recorded.empty() || !is_collecting_errors()) {
+			return;
+		}
+
+		const PackedStringArray instance_prefix = materialize_path(instance_path_stack);
+		const PackedStringArray schema_prefix = materialize_path(schema_path_stack);
+		for (const ValidationError &error : recorded) {
+			ValidationError &replayed = errors.emplace_back(error);
+			replayed.instance_path_parts = instance_prefix;
+			replayed.instance_path_parts.append_array(error.instance_path_parts.slice(instance_depth));
+			replayed.schema_path_parts = schema_prefix;
+			replayed.schema_path_parts.append_array(error.schema_path_parts.slice(schema_depth));
 		}
-		return ValidationContext(source_schema, instance_path_parts, new_parts);
 	}
 
 	/**
-	 * @brief Creates a child context with both paths updated
-	 * @param instance_segment Instance path segment
-	 * @param schema_segment Schema path segment
-	 * @return New validation context
+	 * @brief Clears errors and paths so the context can validate another value
+	 *
+	 * Keeps the allocated storage, the error limits and custom data.
+	 */
+	void reset() {
+		instance_path_stack.clear();
+		subtree_error_bases.clear();
+		schema_path_stack.clear();
+		errors.clear();
+		depth = 0;
+		memo.clear();
+		memo_depth = 0;
+		memo_low = std::numeric_limits<size_t>::max();
+	}
+
+	/**
+	 * @brief Limits the number of errors recorded
+	 * @param p_max_errors Maximum errors for the whole validation, 0 for unlimited
+	 * @param p_max_errors_per_subtree Maximum errors under any array item or property value, 0 for unlimited
+	 *
+	 * Every array item or property value is a subtree with its own budget,
+	 * counting the errors recorded since it was entered, its descendants'
+	 * included. Only the innermost subtree's budget is checked, so rules
+	 * iterating children decide whether to stop after leaving a child.
+	 */
+	void set_error_limits(size_t p_max_errors, size_t p_max_errors_per_subtree) {
+		max_errors = p_max_errors;
+		max_errors_per_subtree = p_max_errors_per_subtree;
+	}
+
+	/**
+	 * @brief Checks if error limits are set
+	 * @return True if max_errors or max_errors_per_subtree is set
+	 */
+	bool has_error_limits() const { return max_errors > 0 || max_errors_per_subtree > 0; }
+
+	/**
+	 * @brief Sets the minimum array size at which array items are validated in parallel
+	 * @param threshold Minimum item count, 0 to always validate sequentially
+	 */
+	void set_parallel_items_threshold(int64_t threshold) { parallel_items_threshold = threshold; }
+
+	/**
+	 * @brief Gets the minimum array size at which array items are validated in parallel
+	 * @return Minimum item count, 0 if parallel item validation is disabled
+	 */
+	int64_t get_parallel_items_threshold() const { return parallel_items_threshold; }
+
+	/**
+	 * @brief Creates an empty context at the current paths for validating part of the data on another thread
+	 * @return Context with the same paths and settings but no errors
+	 *
+	 * Forked contexts never validate items in parallel themselves, so work is
+	 * not split again on worker threads. They inherit the in-progress memo
+	 * entries, so data cycling back to a container being validated hits the
+	 * memo on the worker too. Merge the results back with join().
 	 */
-	ValidationContext create_child_context(const String &instance_segment, const String &schema_segment = "") const {
-		PackedStringArray new_instance_parts = instance_path_parts;
-		if (!instance_segment.is_empty()) {
-			new_instance_parts.push_back(instance_segment);
+	ValidationContext fork() const {
+		ValidationContext child(source_schema, collect_errors);
+		child.instance_path_stack = instance_path_stack;
+		child.subtree_error_bases.assign(subtree_error_bases.size(), 0); // The child counts its own errors
+		child.schema_path_stack = schema_path_stack;
+		child.custom_data = custom_data;
+		child.max_errors = max_errors;
+		child.max_errors_per_subtree = max_errors_per_subtree;
+		child.max_depth = max_depth;
+		child.depth = depth;
+		child.memoize = memoize;
+		if (memoize) {
+			for (const auto &entry : memo) {
+				if (entry.second.state == MEMO_IN_PROGRESS) {
+					child.memo.insert(entry);
+				}
+			}
+			child.memo_depth = memo_depth;
 		}
+		return child;
+	}
+
+	/**
+	 * @brief Appends the errors of a context created with fork()
+	 * @param child The forked context, its errors are moved out
+	 */
+	void join(ValidationContext &child) {
+		errors.insert(errors.end(), std::make_move_iterator(child.errors.begin()), std::make_move_iterator(child.errors.end()));
+		child.errors.clear();
 
-		PackedStringArray new_schema_parts = schema_path_parts;
-		if (!schema_segment.is_empty()) {
-			new_schema_parts.push_back(schema_segment);
+		// Results of the enclosing in-progress entries depend on what the child assumed
+		memo_low = std::min(memo_low, child.memo_low);
+	}
+
+	/**
+	 * @brief Checks if an error budget is used up at the current position
+	 * @return True if no more errors may be recorded here
+	 */
+	bool is_error_budget_exhausted() const {
+		if (max_errors > 0 && errors.size() >= max_errors) {
+			return true;
 		}
-		return ValidationContext(source_schema, new_instance_parts, new_schema_parts);
+		// Truncated speculative errors can leave the count below the base
+		return max_errors_per_subtree > 0 && !subtree_error_bases.empty() &&
+				errors.size() >= subtree_error_bases.back() + max_errors_per_subtree;
 	}
 
 	/**
-	 * @brief Adds a validation error
+	 * @class InstanceScope
+	 * @brief RAII guard that appends a segment to the instance path for its lifetime
+	 */
+	class InstanceScope {
+	private:
+		ValidationContext &context;
+		bool pushed;
+
+	public:
+		InstanceScope(ValidationContext &ctx, const PathSegment &segment) :
+				context(ctx), pushed(ctx.push_instance_segment(segment)) {}
+
+		~InstanceScope() {
+			if (pushed) {
+				context.pop_instance_segment();
+			}
+		}
+
+		InstanceScope(const InstanceScope &) = delete;
+		InstanceScope &operator=(const InstanceScope &) = delete;
+	};
+
+	/**
+	 * @class SchemaScope
+	 * @brief RAII guard that appends a segment to the Schema path for its lifetime
+	 */
+	class SchemaScope {
+	private:
+		ValidationContext &context;
+		bool pushed;
+
+	public:
+		SchemaScope(ValidationContext &ctx, const String &segment) :
+				context(ctx), pushed(!segment.is_empty()) {
+			if (pushed) {
+				context.schema_path_stack.push_back(segment);
+			}
+		}
+
+		~SchemaScope() {
+			if (pushed) {
+				context.schema_path_stack.pop_back();
+			}
+		}
+
+		SchemaScope(const SchemaScope &) = delete;
+		SchemaScope &operator=(const SchemaScope &) = delete;
+	};
+
+	/**
+	 * @brief Adds a validation error at the current instance and Schema paths
 	 * @param message Error message
 	 * @param keyword Schema keyword that failed (optional)
 	 * @param invalid_value The value that failed validation (optional)
 	 */
 	void add_error(const String &message, const String &keyword = "",
 			const Variant &invalid_value = Variant()) {
-		errors.emplace_back(message, instance_path_parts, schema_path_parts,
+		if (!is_collecting_errors()) {
+			return;
+		}
+		errors.emplace_back(message, materialize_path(instance_path_stack), materialize_path(schema_path_stack),
 				keyword, invalid_value);
 	}
 
 	/**
-	 * @brief Merges errors from another context into this one
-	 * @param other The other context to merge from
+	 * @brief Adds a validation error whose message is formatted when it is read
+	 * @param keyword Schema keyword that failed
+	 * @param invalid_value The value that failed validation
+	 * @param format Static message format string for vformat()
+	 * @param args Format arguments, at most ValidationError::MAX_MESSAGE_ARGS
+	 *
+	 * Arguments are stored, not formatted, so Variants are passed as is rather
+	 * than stringified. Wrap values of the data in ValidationError::MessageData.
+	 */
+	template <typename... Args>
+	void report_error(const char *keyword, const Variant &invalid_value, const char *format, const Args &...args) {
+		if (!is_collecting_errors()) {
+			return;
+		}
+		ValidationError &error = errors.emplace_back(String(), materialize_path(instance_path_stack), materialize_path(schema_path_stack),
+				String(keyword), invalid_value);
+		error.set_message_format(format, args...);
+	}
+
+	/**
+	 * @brief Adds a validation error before the errors recorded since a checkpoint
+	 * @param position Checkpoint previously returned by error_count()
+	 * @param keyword Schema keyword that failed
+	 * @param invalid_value The value that failed validation
+	 * @param format Static message format string for vformat()
+	 * @param args Format arguments, see report_error()
+	 *
+	 * Used by combinators that report a summary error ahead of the sub-schema
+	 * errors that caused it.
+	 */
+	template <typename... Args>
+	void report_error_at(size_t position, const char *keyword, const Variant &invalid_value, const char *format, const Args &...args) {
+		if (!is_collecting_errors()) {
+			return;
+		}
+		if (position > errors.size()) {
+			position = errors.size();
+		}
+		auto inserted = errors.emplace(errors.begin() + position, String(), materialize_path(instance_path_stack),
+				materialize_path(schema_path_stack), String(keyword), invalid_value);
+		inserted->set_message_format(format, args...);
+	}
+
+	/**
+	 * @brief Discards all errors recorded after a checkpoint
+	 * @param count Checkpoint previously returned by error_count()
+	 *
+	 * Used to evaluate speculative branches (anyOf, not, if, contains) without
+	 * allocating a separate context per branch.
 	 */
-	void merge_errors(const ValidationContext &other) {
-		errors.insert(errors.end(), other.errors.begin(), other.errors.end());
+	void truncate_errors(size_t count) {
+		if (count < errors.size()) {
+			errors.erase(errors.begin() + count, errors.end());
+		}
 	}
 
+	/**
+	 * @brief Checks if errors are being collected
+	 * @return True if error messages are recorded, false in fail-fast mode or once the error budget is exhausted
+	 */
+	bool is_collecting_errors() const { return collect_errors && !is_error_budget_exhausted(); }
+
+	/**
+	 * @brief Checks if rules should stop validating after a failure
+	 * @return True in fail-fast mode or once the error budget is exhausted, where only the pass/fail outcome matters
+	 */
+	bool should_stop_on_failure() const { return !is_collecting_errors(); }
+
 	/**
 	 * @brief Checks if validation was successful
 	 * @return True if no errors occurred
@@ -129,6 +606,21 @@ public:
 	 */
 	const std::vector<ValidationError> &get_errors() const { return errors; }
 
+	/**
+	 * @brief Moves the validation errors out of the context
+	 * @return The errors, the context is left without errors
+	 *
+	 * The errors outlive the validation, so their data arguments are frozen.
+	 */
+	std::vector<ValidationError> take_errors() {
+		std::vector<ValidationError> taken;
+		taken.swap(errors);
+		for (ValidationError &error : taken) {
+			error.freeze_message_args();
+		}
+		return taken;
+	}
+
 	/**
 	 * @brief Gets all errors as an Array of Dictionaries
 	 * @return Array containing error information
@@ -146,22 +638,13 @@ public:
 	 * @brief Gets the current instance path
 	 * @return Instance path string
 	 */
-	String get_instance_path() const {
-		if (instance_path_parts.is_empty()) {
-			return String();
-		}
-		return "/" + String("/").join(instance_path_parts);
-	}
+	String get_instance_path() const { return join_path(instance_path_stack); }
+
 	/**
 	 * @brief Gets the current Schema path
 	 * @return Schema path string
 	 */
-	String get_schema_path() const {
-		if (schema_path_parts.is_empty()) {
-			return String();
-		}
-		return "/" + String("/").join(schema_path_parts);
-	}
+	String get_schema_path() const { return join_path(schema_path_stack); }
 
 	/**
 	 * @brief Gets the source Schema reference
@@ -230,25 +713,6 @@ public:
 				return "unknown";
 		}
 	}
-
-private:
-	/**
-	 * @brief Builds a JSON Pointer style path
-	 * @param base_path The base path
-	 * @param segment The segment to append
-	 * @return Combined path
-	 */
-	static String build_path(const String &base_path, const String &segment) {
-		if (segment.is_empty()) {
-			return base_path;
-		}
-
-		if (base_path.is_empty()) {
-			return "/" + segment;
-		}
-
-		return base_path + String("/") + segment;
-	}
 };
 
 } // namespace godot
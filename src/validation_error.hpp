@@ -2,19 +2,55 @@
 
 #include <godot_cpp/variant/variant.hpp>
 
+#include <cstdint>
+
 namespace godot {
 
 /**
  * @struct ValidationError
  * @brief Represents a single validation error with detailed path information
+ *
+ * Messages reported by rules are kept as a static format string and its
+ * arguments, and only formatted by get_message(). Errors of speculative
+ * branches that are discarded never pay for formatting or stringify().
+ * Arguments taken from the validated data (MessageData) are stringified by
+ * freeze_message_args() once the error leaves the validation, so later
+ * changes to the data do not change the message.
  */
 struct ValidationError {
-	String message;
+	/**
+	 * @brief Maximum number of arguments of a deferred message
+	 */
+	static constexpr int MAX_MESSAGE_ARGS = 3;
+
+	/**
+	 * @struct MessageList
+	 * @brief Message argument formatted as its stringified elements joined by ", "
+	 */
+	struct MessageList {
+		Array values;
+	};
+
+	/**
+	 * @struct MessageData
+	 * @brief Message argument taken from the validated data, which the caller may change afterwards
+	 */
+	struct MessageData {
+		Variant value;
+	};
+
+	String message; // Preformatted message, unused while message_format is set
 	PackedStringArray instance_path_parts;
 	PackedStringArray schema_path_parts;
 	String keyword;
 	Variant invalid_value;
 
+	const char *message_format = nullptr; // Static format string for vformat()
+	Variant message_args[MAX_MESSAGE_ARGS];
+	uint8_t message_arg_count = 0;
+	uint8_t message_list_args = 0; // Bit per MessageList argument
+	uint8_t message_data_args = 0; // Bit per MessageData argument not frozen yet
+
 	ValidationError(const String &msg,
 			const PackedStringArray &inst_parts = PackedStringArray(),
 			const PackedStringArray &sch_parts = PackedStringArray(),
@@ -22,6 +58,70 @@ struct ValidationError {
 			const Variant &value = Variant()) :
 			message(msg), instance_path_parts(inst_parts), schema_path_parts(sch_parts), keyword(kw), invalid_value(value) {}
 
+	/**
+	 * @brief Defers formatting of the message
+	 * @param format Static format string for vformat()
+	 * @param args Format arguments, MessageList for joined lists, MessageData for values of the data
+	 */
+	template <typename... Args>
+	void set_message_format(const char *format, const Args &...args) {
+		static_assert(sizeof...(Args) <= MAX_MESSAGE_ARGS, "Too many message arguments");
+		message_format = format;
+		message_arg_count = sizeof...(Args);
+		[[maybe_unused]] int index = 0;
+		(set_message_arg(index++, args), ...);
+	}
+
+	/**
+	 * @brief Stringifies the MessageData arguments that are Dictionaries or Arrays
+	 *
+	 * Containers are shared with the caller's data. Called once the error is
+	 * kept, errors discarded by speculative branches never pay for it.
+	 */
+	void freeze_message_args() {
+		for (int i = 0; message_data_args != 0 && i < message_arg_count; i++) {
+			if (message_data_args & (1 << i)) {
+				const Variant::Type type = message_args[i].get_type();
+				if (type == Variant::DICTIONARY || type == Variant::ARRAY) {
+					message_args[i] = message_args[i].stringify();
+				}
+				message_data_args &= ~(1 << i);
+			}
+		}
+	}
+
+	/**
+	 * @brief Gets the message, formatting it if it was deferred
+	 * @return Error message
+	 */
+	String get_message() const {
+		if (!message_format) {
+			return message;
+		}
+		if (message_arg_count == 0) {
+			return String(message_format);
+		}
+
+		Array args;
+		args.resize(message_arg_count);
+		for (int i = 0; i < message_arg_count; i++) {
+			if (message_list_args & (1 << i)) {
+				const Array values = message_args[i];
+				String joined;
+				for (int64_t j = 0; j < values.size(); j++) {
+					if (j > 0) {
+						joined += ", ";
+					}
+					joined += values[j].stringify();
+				}
+				args[i] = joined;
+			} else {
+				args[i] = message_args[i];
+			}
+		}
+		return String(message_format) % args;
+	}
+
 	/**
 	 * @brief Get the instance path as a string
 	 * @return Instance path string (e.g. "/user/name")
@@ -50,7 +150,7 @@ struct ValidationError {
 	 */
 	Dictionary to_dict() const {
 		Dictionary result;
-		result["message"] = message;
+		result["message"] = get_message();
 		result["instance_path"] = get_instance_path();
 		result["instance_path_array"] = instance_path_parts;
 		result["schema_path"] = get_schema_path();
@@ -59,6 +159,19 @@ struct ValidationError {
 		result["invalid_value"] = invalid_value;
 		return result;
 	}
+
+private:
+	void set_message_arg(int index, const Variant &value) { message_args[index] = value; }
+
+	void set_message_arg(int index, const MessageData &data) {
+		message_args[index] = data.value;
+		message_data_args |= 1 << index;
+	}
+
+	void set_message_arg(int index, const MessageList &list) {
+		message_args[index] = list.values;
+		message_list_args |= 1 << index;
+	}
 };
 
 } //namespace godot
@@ -3,6 +3,8 @@
 
 using namespace godot;
 
+Ref<SchemaValidationResult> SchemaValidationResult::shared_success;
+
 void SchemaValidationResult::_bind_methods() {
 	// Status checking
 	ClassDB::bind_method(D_METHOD("is_valid"), &SchemaValidationResult::is_valid);
@@ -30,19 +32,31 @@ void SchemaValidationResult::_bind_methods() {
 	BIND_VIRTUAL_METHOD(SchemaValidationResult, _to_string);
 }
 
-Ref<SchemaValidationResult> SchemaValidationResult::from_context(const ValidationContext &context) {
-	Ref<SchemaValidationResult> result = memnew(SchemaValidationResult);
-
-	const std::vector<ValidationError> &context_errors = context.get_errors();
-	for (const ValidationError &error : context_errors) {
-		result->add_error(error);
+Ref<SchemaValidationResult> SchemaValidationResult::from_context(ValidationContext &context) {
+	// Most validations pass, they share one result instead of allocating
+	if (!context.has_errors()) {
+		return success();
 	}
 
+	Ref<SchemaValidationResult> result = memnew(SchemaValidationResult);
+	result->assign_from_context(context);
 	return result;
 }
 
 Ref<SchemaValidationResult> SchemaValidationResult::success() {
-	return memnew(SchemaValidationResult);
+	if (shared_success.is_valid()) {
+		return shared_success;
+	}
+	return memnew(SchemaValidationResult); // Extension not initialized
+}
+
+void SchemaValidationResult::create_shared_results() {
+	shared_success = Ref<SchemaValidationResult>(memnew(SchemaValidationResult));
+	shared_success->set_shared();
+}
+
+void SchemaValidationResult::free_shared_results() {
+	shared_success.unref();
 }
 
 Array SchemaValidationResult::get_errors() const {
@@ -63,7 +77,7 @@ Dictionary SchemaValidationResult::get_error(int index) const {
 
 String SchemaValidationResult::get_error_message(int index) const {
 	if (index >= 0 && index < static_cast<int>(errors.size())) {
-		return errors[index].message;
+		return errors[index].get_message();
 	}
 	return "";
 }
@@ -113,7 +127,7 @@ String SchemaValidationResult::get_summary() const {
 			summary += vformat("At '%s': ", err_path);
 		}
 
-		summary += error.message;
+		summary += error.get_message();
 
 		if (!error.keyword.is_empty()) {
 			summary += vformat(" (%s)", error.keyword);
@@ -180,3 +194,36 @@ void SchemaValidationResult::add_error(const ValidationError &error) {
 	errors.push_back(error);
 	validation_succeeded = false;
 }
+
+void SchemaValidationResult::assign_from_context(ValidationContext &context) {
+	errors = context.take_errors();
+	validation_succeeded = errors.empty();
+	snapshot.reset();
+}
+
+void SchemaValidationResult::assign(const SchemaValidationResult &other) {
+	errors = other.errors;
+	validation_succeeded = other.validation_succeeded;
+	snapshot.reset();
+}
+
+size_t SchemaValidationResult::estimate_memory_usage() const {
+	const auto string_bytes = [](const String &str) {
+		return sizeof(String) + static_cast<size_t>(str.length()) * sizeof(char32_t);
+	};
+	const auto path_bytes = [&string_bytes](const PackedStringArray &parts) {
+		size_t total = sizeof(PackedStringArray);
+		for (int64_t i = 0; i < parts.size(); i++) {
+			total += string_bytes(parts[i]);
+		}
+		return total;
+	};
+
+	// Invalid values are shared with the validated data and not counted
+	size_t total = sizeof(SchemaValidationResult);
+	for (const ValidationError &error : errors) {
+		total += sizeof(ValidationError) + string_bytes(error.message) + string_bytes(error.keyword); // Deferred arguments are counted in sizeof
+		total += path_bytes(error.instance_path_parts) + path_bytes(error.schema_path_parts);
+	}
+	return total;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "validation_error.hpp"
+#include "validation_snapshot.hpp"
 
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/core/class_db.hpp>
@@ -9,6 +10,7 @@
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace godot {
@@ -29,6 +31,10 @@ class SchemaValidationResult : public RefCounted {
 private:
 	std::vector<ValidationError> errors;
 	bool validation_succeeded;
+	std::shared_ptr<ValidationSnapshot> snapshot; // Per-container results for Schema::validate_patch()
+	bool shared = false; // Returned to several callers, must not be modified
+
+	static Ref<SchemaValidationResult> shared_success;
 
 protected:
 	static void _bind_methods();
@@ -42,17 +48,27 @@ public:
 
 	/**
 	 * @brief Creates result from internal ValidationContext
-	 * @param context The internal validation context with tree structure
-	 * @return New result with flattened error list
+	 * @param context The internal validation context, its errors are moved out
+	 * @return New result with flattened error list, or the shared success result if there are no errors
 	 */
-	static Ref<SchemaValidationResult> from_context(const ValidationContext &context);
+	static Ref<SchemaValidationResult> from_context(ValidationContext &context);
 
 	/**
-	 * @brief Creates successful validation result
-	 * @return Result indicating validation passed
+	 * @brief Gets the successful validation result
+	 * @return Shared, immutable result indicating validation passed
 	 */
 	static Ref<SchemaValidationResult> success();
 
+	/**
+	 * @brief Creates the shared success result, called when the extension initializes
+	 */
+	static void create_shared_results();
+
+	/**
+	 * @brief Releases the shared success result, called when the extension uninitializes
+	 */
+	static void free_shared_results();
+
 	// ========== Status Checking ==========
 
 	/**
@@ -161,6 +177,49 @@ public:
 	 * @param error The error to add
 	 */
 	void add_error(const ValidationError &error);
+
+	/**
+	 * @brief Replaces the errors with those of a validation run
+	 * @param context The validation context, its errors are moved out
+	 */
+	void assign_from_context(ValidationContext &context);
+
+	/**
+	 * @brief Replaces the errors with those of another result
+	 * @param other The result to copy
+	 */
+	void assign(const SchemaValidationResult &other);
+
+	/**
+	 * @brief Marks the result as returned to several callers
+	 *
+	 * Shared results are never modified, e.g. by Schema::validate_into().
+	 */
+	void set_shared() { shared = true; }
+
+	/**
+	 * @brief Checks if the result is returned to several callers
+	 * @return True if the result must not be modified
+	 */
+	bool is_shared() const { return shared; }
+
+	/**
+	 * @brief Estimates the memory held by this result
+	 * @return Approximate size in bytes, used to bound Schema's result cache
+	 */
+	size_t estimate_memory_usage() const;
+
+	/**
+	 * @brief Attaches the snapshot of the validation run that produced this result
+	 * @param p_snapshot The snapshot
+	 */
+	void set_snapshot(std::shared_ptr<ValidationSnapshot> p_snapshot) { snapshot = std::move(p_snapshot); }
+
+	/**
+	 * @brief Takes the attached snapshot, the result keeps its errors but can no longer be patched
+	 * @return The snapshot, or null if none is attached
+	 */
+	std::shared_ptr<ValidationSnapshot> take_snapshot() { return std::move(snapshot); }
 };
 
 } // namespace godot
@@ -0,0 +1,79 @@
+#include "validation_result_cache.hpp"
+
+using namespace godot;
+
+void ValidationResultCache::evict() {
+	const size_t entry_limit = static_cast<size_t>(max_entries.load(std::memory_order_relaxed));
+	const size_t byte_limit = static_cast<size_t>(max_bytes.load(std::memory_order_relaxed));
+
+	while (!entries.empty() && (entries.size() > entry_limit || (byte_limit > 0 && bytes > byte_limit))) {
+		const Entry &oldest = entries.back();
+		bytes -= oldest.bytes;
+		index.erase(oldest.content_hash);
+		entries.pop_back();
+	}
+}
+
+Ref<SchemaValidationResult> ValidationResultCache::lookup(uint64_t content_hash, uint64_t &r_generation) {
+	std::lock_guard<std::mutex> lock(mutex);
+	r_generation = generation;
+
+	const auto found = index.find(content_hash);
+	if (found == index.end()) {
+		misses++;
+		return Ref<SchemaValidationResult>();
+	}
+
+	hits++;
+	entries.splice(entries.begin(), entries, found->second);
+	return found->second->result;
+}
+
+void ValidationResultCache::insert(uint64_t content_hash, uint64_t p_generation, const Ref<SchemaValidationResult> &result) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (p_generation != generation || index.find(content_hash) != index.end()) {
+		return; // Cleared since the lookup, or inserted by a concurrent run
+	}
+
+	const size_t entry_bytes = sizeof(Entry) + result->estimate_memory_usage();
+	const size_t byte_limit = static_cast<size_t>(max_bytes.load(std::memory_order_relaxed));
+	if (byte_limit > 0 && entry_bytes > byte_limit) {
+		return; // Would evict everything and still not fit
+	}
+
+	result->set_shared(); // Handed to every later hit
+	entries.push_front({ content_hash, result, entry_bytes });
+	index.emplace(content_hash, entries.begin());
+	bytes += entry_bytes;
+	evict();
+}
+
+void ValidationResultCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	index.clear();
+	bytes = 0;
+	generation++;
+}
+
+void ValidationResultCache::set_max_entries(int64_t p_max_entries) {
+	std::lock_guard<std::mutex> lock(mutex);
+	max_entries.store(p_max_entries, std::memory_order_relaxed);
+	evict();
+}
+
+void ValidationResultCache::set_max_bytes(int64_t p_max_bytes) {
+	std::lock_guard<std::mutex> lock(mutex);
+	max_bytes.store(p_max_bytes, std::memory_order_relaxed);
+	evict();
+}
+
+Dictionary ValidationResultCache::get_stats() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	Dictionary stats;
+	stats["hits"] = static_cast<int64_t>(hits);
+	stats["misses"] = static_cast<int64_t>(misses);
+	stats["entries"] = static_cast<int64_t>(entries.size());
+	stats["bytes"] = static_cast<int64_t>(bytes);
+	return stats;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "validation_result.hpp"
+
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace godot {
+
+/**
+ * @class ValidationResultCache
+ * @brief Bounded LRU cache of validation results keyed by the content hash of the data
+ *
+ * Shared by every thread validating against the same Schema. The cache is
+ * bounded by an entry count and optionally by the estimated memory of the
+ * cached results, the least recently used results are evicted first.
+ */
+class ValidationResultCache {
+private:
+	struct Entry {
+		uint64_t content_hash;
+		Ref<SchemaValidationResult> result;
+		size_t bytes;
+	};
+
+	mutable std::mutex mutex;
+	std::list<Entry> entries; // Most recently used first
+	std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+	size_t bytes = 0;
+	uint64_t generation = 0; // Bumped by clear(), results of older runs are not inserted
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+
+	std::atomic<int64_t> max_entries{ 0 };
+	std::atomic<int64_t> max_bytes{ 0 };
+
+	void evict();
+
+public:
+	/**
+	 * @brief Checks if results are cached at all
+	 * @return True if the capacity is not 0
+	 */
+	bool is_enabled() const { return max_entries.load(std::memory_order_relaxed) > 0; }
+
+	/**
+	 * @brief Looks up the result for a content hash
+	 * @param content_hash Hash from ContentHash::hash64()
+	 * @param r_generation Receives the generation to pass to insert() on a miss
+	 * @return The cached result, or null on a miss
+	 */
+	Ref<SchemaValidationResult> lookup(uint64_t content_hash, uint64_t &r_generation);
+
+	/**
+	 * @brief Caches the result for a content hash
+	 * @param content_hash Hash from ContentHash::hash64()
+	 * @param p_generation Generation returned by the lookup() that missed
+	 * @param result The result, shared with every later hit
+	 */
+	void insert(uint64_t content_hash, uint64_t p_generation, const Ref<SchemaValidationResult> &result);
+
+	/**
+	 * @brief Removes every cached result
+	 */
+	void clear();
+
+	/**
+	 * @brief Sets the maximum number of cached results
+	 * @param p_max_entries Maximum entries, 0 disables the cache
+	 */
+	void set_max_entries(int64_t p_max_entries);
+
+	/**
+	 * @brief Gets the maximum number of cached results
+	 * @return Maximum entries, 0 if disabled
+	 */
+	int64_t get_max_entries() const { return max_entries.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Sets the maximum estimated memory of the cached results
+	 * @param p_max_bytes Maximum bytes, 0 for unlimited
+	 */
+	void set_max_bytes(int64_t p_max_bytes);
+
+	/**
+	 * @brief Gets the maximum estimated memory of the cached results
+	 * @return Maximum bytes, 0 for unlimited
+	 */
+	int64_t get_max_bytes() const { return max_bytes.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Gets the cache counters
+	 * @return Dictionary with "hits", "misses", "entries" and "bytes"
+	 */
+	Dictionary get_stats() const;
+};
+
+} // namespace godot
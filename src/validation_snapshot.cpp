@@ -0,0 +1,182 @@
+#include "validation_snapshot.hpp"
+#include "util.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+using namespace godot;
+
+ValidationSnapshot::ValidationSnapshot(const std::shared_ptr<const RuleGroup> &rules, const Variant &data) :
+		root_rules(rules), root_id(SchemaUtil::get_container_id(data)) {}
+
+bool ValidationSnapshot::is_compatible(const std::shared_ptr<const RuleGroup> &rules, const Variant &data) const {
+	return root_rules == rules && root_id != 0 && root_id == SchemaUtil::get_container_id(data);
+}
+
+const ValidationSnapshot::Entry *ValidationSnapshot::find(const RuleGroup *rules, uintptr_t container_id) const {
+	const auto found = containers.find(container_id);
+	if (found == containers.end()) {
+		return nullptr;
+	}
+	for (const Entry &entry : found->second.entries) {
+		if (entry.rules == rules) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+void ValidationSnapshot::begin_record(uintptr_t container_id) {
+	recording.push_back({ container_id, {} });
+}
+
+void ValidationSnapshot::record(const Variant &container, uintptr_t container_id, Entry &&entry) {
+	std::vector<uintptr_t> children;
+	if (!recording.empty() && recording.back().container_id == container_id) {
+		children = std::move(recording.back().children);
+		recording.pop_back();
+	}
+
+	ContainerEntries &recorded = containers[container_id];
+	if (recorded.entries.empty()) {
+		recorded.container = container;
+	}
+	bool replaced = false;
+	for (Entry &existing : recorded.entries) {
+		if (existing.rules == entry.rules) {
+			existing = std::move(entry);
+			replaced = true;
+			break;
+		}
+	}
+	if (!replaced) {
+		recorded.entries.push_back(std::move(entry));
+	}
+
+	for (const uintptr_t child_id : children) {
+		const auto child = containers.find(child_id);
+		if (child == containers.end()) {
+			continue;
+		}
+		recorded.children.push_back(child_id);
+		std::vector<uintptr_t> &parents = child->second.parents;
+		if (std::find(parents.begin(), parents.end(), container_id) == parents.end()) {
+			parents.push_back(container_id);
+		}
+	}
+
+	add_child(container_id);
+}
+
+void ValidationSnapshot::add_child(uintptr_t container_id) {
+	// Rule groups applied to the same container (e.g. allOf) are not its children
+	if (!recording.empty() && recording.back().container_id != container_id) {
+		recording.back().children.push_back(container_id);
+	}
+}
+
+void ValidationSnapshot::erase_with_parents(uintptr_t container_id) {
+	// A container shared by several parents invalidates all of them
+	std::vector<uintptr_t> pending{ container_id };
+	while (!pending.empty()) {
+		const uintptr_t current = pending.back();
+		pending.pop_back();
+
+		const auto found = containers.find(current);
+		if (found == containers.end()) {
+			continue;
+		}
+		pending.insert(pending.end(), found->second.parents.begin(), found->second.parents.end());
+		containers.erase(found);
+	}
+}
+
+void ValidationSnapshot::prune() {
+	if (containers.size() <= 2 * pruned_size) {
+		return;
+	}
+
+	std::unordered_set<uintptr_t> reachable;
+	std::vector<uintptr_t> pending{ root_id };
+	while (!pending.empty()) {
+		const uintptr_t current = pending.back();
+		pending.pop_back();
+
+		const auto found = containers.find(current);
+		if (found == containers.end() || !reachable.insert(current).second) {
+			continue;
+		}
+		pending.insert(pending.end(), found->second.children.begin(), found->second.children.end());
+	}
+
+	// Removed or replaced containers, released with their references
+	for (auto it = containers.begin(); it != containers.end();) {
+		if (reachable.count(it->first)) {
+			++it;
+		} else {
+			it = containers.erase(it);
+		}
+	}
+	pruned_size = containers.size();
+}
+
+void ValidationSnapshot::invalidate(const Variant &data, const PackedStringArray &path) {
+	Variant current = data;
+	for (int64_t i = 0; i < path.size(); i++) {
+		// Containers on the path depend on the edited value
+		erase_with_parents(SchemaUtil::get_container_id(current));
+
+		const String &segment = path[i];
+		if (current.get_type() == Variant::DICTIONARY) {
+			const Dictionary dict = current;
+			if (dict.has(segment)) {
+				current = dict[segment];
+			} else if (segment.is_valid_int() && dict.has(segment.to_int())) {
+				current = dict[segment.to_int()];
+			} else {
+				return; // Removed, nothing below to forget
+			}
+		} else if (current.get_type() == Variant::ARRAY) {
+			const Array array = current;
+			const int64_t index = segment.is_valid_int() ? segment.to_int() : -1;
+			if (index < 0 || index >= array.size()) {
+				return;
+			}
+			current = array[index];
+		} else {
+			return;
+		}
+	}
+
+	invalidate_subtree(current);
+}
+
+void ValidationSnapshot::invalidate_subtree(const Variant &value) {
+	// Explicit stack, edited subtrees can be deep or cyclic
+	std::vector<Variant> pending;
+	std::unordered_set<uintptr_t> visited;
+	pending.push_back(value);
+
+	while (!pending.empty()) {
+		const Variant current = pending.back();
+		pending.pop_back();
+
+		const uintptr_t container_id = SchemaUtil::get_container_id(current);
+		if (container_id == 0 || !visited.insert(container_id).second) {
+			continue;
+		}
+		erase_with_parents(container_id);
+
+		if (current.get_type() == Variant::DICTIONARY) {
+			const Array values = current.operator Dictionary().values();
+			for (int64_t i = 0; i < values.size(); i++) {
+				pending.push_back(values[i]);
+			}
+		} else {
+			const Array array = current;
+			for (int64_t i = 0; i < array.size(); i++) {
+				pending.push_back(array[i]);
+			}
+		}
+	}
+}
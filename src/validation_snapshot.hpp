@@ -0,0 +1,147 @@
+#pragma once
+
+#include "validation_error.hpp"
+
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace godot {
+
+// Forward declarations
+class RuleGroup;
+
+/**
+ * @class ValidationSnapshot
+ * @brief Results of a validation run per compiled subschema and container, reused by Schema::validate_patch()
+ *
+ * Every RuleGroup that validates a Dictionary or Array records its outcome and
+ * the errors it produced. The next run replays the recorded result instead of
+ * descending again, unless the container was invalidated because an edit
+ * touched it, one of its descendants or one of its ancestors' paths.
+ *
+ * Recorded containers are referenced, so their identity cannot be reused by
+ * another allocation while the snapshot lives. Containers remember the
+ * recorded containers nested in them and the containers they are nested in,
+ * so an edit also invalidates every other parent of a shared container, and
+ * containers no longer reachable from the document are pruned.
+ */
+class ValidationSnapshot {
+public:
+	/**
+	 * @struct Entry
+	 * @brief Recorded result of a RuleGroup on one container
+	 */
+	struct Entry {
+		const RuleGroup *rules = nullptr;
+		bool valid = true;
+		size_t instance_depth = 0; // Instance path length when recorded, errors are relative to it
+		size_t schema_depth = 0; // Schema path length when recorded
+		std::vector<ValidationError> errors;
+	};
+
+private:
+	struct ContainerEntries {
+		Variant container; // Keeps the container alive
+		std::vector<Entry> entries; // One per RuleGroup, usually a handful
+		std::vector<uintptr_t> children; // Recorded containers validated while this one was
+		std::vector<uintptr_t> parents; // Containers that list this one as a child
+	};
+
+	/**
+	 * @struct RecordingFrame
+	 * @brief A container being validated by validate_and_record(), collecting its children
+	 */
+	struct RecordingFrame {
+		uintptr_t container_id;
+		std::vector<uintptr_t> children;
+	};
+
+	std::shared_ptr<const RuleGroup> root_rules; // Rules the snapshot was recorded with
+	uintptr_t root_id = 0;
+	std::unordered_map<uintptr_t, ContainerEntries> containers;
+	std::vector<RecordingFrame> recording;
+	size_t pruned_size = 0; // Container count after the last prune()
+
+	void add_child(uintptr_t container_id);
+	void erase_with_parents(uintptr_t container_id);
+	void invalidate_subtree(const Variant &value);
+
+public:
+	/**
+	 * @brief Constructor
+	 * @param rules The compiled rules of the validating Schema
+	 * @param data The validated document
+	 */
+	ValidationSnapshot(const std::shared_ptr<const RuleGroup> &rules, const Variant &data);
+
+	/**
+	 * @brief Checks if the snapshot can be reused for a document
+	 * @param rules The compiled rules of the validating Schema
+	 * @param data The document
+	 * @return True if recorded with the same rules for the same root container
+	 */
+	bool is_compatible(const std::shared_ptr<const RuleGroup> &rules, const Variant &data) const;
+
+	/**
+	 * @brief Finds the recorded result of a RuleGroup on a container
+	 * @param rules The RuleGroup
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 * @return The entry, or null if not recorded
+	 */
+	const Entry *find(const RuleGroup *rules, uintptr_t container_id) const;
+
+	/**
+	 * @brief Starts validating a container whose result will be recorded
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 *
+	 * Must be followed by record() for the same container.
+	 */
+	void begin_record(uintptr_t container_id);
+
+	/**
+	 * @brief Records the result of a RuleGroup on a container
+	 * @param container The container
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 * @param entry The result
+	 */
+	void record(const Variant &container, uintptr_t container_id, Entry &&entry);
+
+	/**
+	 * @brief Notes that a recorded result was replayed, keeping it reachable from the enclosing container
+	 * @param container_id Identity from SchemaUtil::get_container_id()
+	 */
+	void replayed(uintptr_t container_id) { add_child(container_id); }
+
+	/**
+	 * @brief Forgets the results affected by an edit
+	 * @param data The edited document
+	 * @param path Segments of the edited value's JSON Pointer, empty for the whole document
+	 *
+	 * Results of every container on the path, of everything below the
+	 * edited value and of every container enclosing a forgotten one through
+	 * another path are forgotten.
+	 */
+	void invalidate(const Variant &data, const PackedStringArray &path);
+
+	/**
+	 * @brief Forgets the containers that are no longer reachable from the document root
+	 *
+	 * Call after a validation run. Removed or replaced containers are only
+	 * found by a walk over all recorded containers, so the walk runs once
+	 * the snapshot has doubled since the last one.
+	 */
+	void prune();
+
+	/**
+	 * @brief Gets the number of containers with recorded results
+	 * @return Container count
+	 */
+	size_t size() const { return containers.size(); }
+};
+
+} // namespace godot